@@ -0,0 +1,81 @@
+#include "allocation_counter.h"
+#include <atomic>
+#include <cstdlib>
+#include <new>
+
+namespace {
+
+std::atomic<std::size_t> num_allocations{0};
+std::atomic<std::size_t> num_bytes{0};
+std::atomic<std::size_t> live_bytes{0};
+std::atomic<std::size_t> peak_live_bytes{0};
+
+// the size of every block is stored in front of it
+constexpr std::size_t header_size = alignof(std::max_align_t);
+
+void *allocate(std::size_t size) {
+  auto *block = static_cast<unsigned char *>(std::malloc(header_size + size));
+  if (block == nullptr) {
+    throw std::bad_alloc{};
+  }
+  *reinterpret_cast<std::size_t *>(block) = size;
+
+  num_allocations.fetch_add(1, std::memory_order_relaxed);
+  num_bytes.fetch_add(size, std::memory_order_relaxed);
+  const auto live = live_bytes.fetch_add(size, std::memory_order_relaxed) + size;
+  auto peak = peak_live_bytes.load(std::memory_order_relaxed);
+  while (live > peak && !peak_live_bytes.compare_exchange_weak(
+                            peak, live, std::memory_order_relaxed)) {
+  }
+  return block + header_size;
+}
+
+void deallocate(void *p) noexcept {
+  if (p == nullptr) {
+    return;
+  }
+  auto *block = static_cast<unsigned char *>(p) - header_size;
+  live_bytes.fetch_sub(*reinterpret_cast<std::size_t *>(block),
+                       std::memory_order_relaxed);
+  std::free(block);
+}
+
+} // namespace
+
+namespace alpaca {
+
+namespace benchmark {
+
+allocation_stats allocation_totals() {
+  return {num_allocations.load(std::memory_order_relaxed),
+          num_bytes.load(std::memory_order_relaxed),
+          live_bytes.load(std::memory_order_relaxed),
+          peak_live_bytes.load(std::memory_order_relaxed)};
+}
+
+void reset_peak_live_bytes() {
+  peak_live_bytes.store(live_bytes.load(std::memory_order_relaxed),
+                        std::memory_order_relaxed);
+}
+
+} // namespace benchmark
+
+} // namespace alpaca
+
+// GCC cannot tell that these replace the global operators
+#if defined(__GNUC__) && !defined(__clang__)
+#pragma GCC diagnostic ignored "-Wmismatched-new-delete"
+#endif
+
+// the nothrow versions call these
+void *operator new(std::size_t size) { return allocate(size); }
+
+void *operator new[](std::size_t size) { return allocate(size); }
+
+void operator delete(void *p) noexcept { deallocate(p); }
+
+void operator delete[](void *p) noexcept { deallocate(p); }
+
+void operator delete(void *p, std::size_t) noexcept { deallocate(p); }
+
+void operator delete[](void *p, std::size_t) noexcept { deallocate(p); }
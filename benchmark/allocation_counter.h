@@ -0,0 +1,33 @@
+#pragma once
+#include <cstddef>
+
+// Replaces the global operator new and delete (see allocation_counter.cpp)
+// to count the heap allocations of the program that links it
+// Allocations with an alignment above __STDCPP_DEFAULT_NEW_ALIGNMENT__ are
+// not counted
+
+namespace alpaca {
+
+namespace benchmark {
+
+struct allocation_stats {
+  // calls to operator new since startup
+  std::size_t allocations;
+
+  // bytes requested from operator new since startup
+  std::size_t bytes;
+
+  // bytes allocated and not yet freed
+  std::size_t live_bytes;
+
+  // largest live_bytes since the last reset_peak_live_bytes()
+  std::size_t peak_live_bytes;
+};
+
+allocation_stats allocation_totals();
+
+void reset_peak_live_bytes();
+
+} // namespace benchmark
+
+} // namespace alpaca
@@ -0,0 +1,48 @@
+#pragma once
+#include "allocation_counter.h"
+#include <benchmark/benchmark.h>
+
+namespace alpaca {
+
+namespace benchmark {
+
+// Reports the heap allocations of a benchmark loop as counters
+//
+//   alpaca::benchmark::allocation_report allocations;
+//   for (auto _ : state) {
+//     ...
+//   }
+//   allocations.report(state);
+//
+// Allocations and BytesAllocated are per iteration, PeakLiveBytes is the
+// most memory held at once by the loop on top of what was held before it
+class allocation_report {
+public:
+  allocation_report() : start_(allocation_totals()) {
+    reset_peak_live_bytes();
+  }
+
+  void report(::benchmark::State &state) const {
+    const auto end = allocation_totals();
+    state.counters["Allocations"] =
+        ::benchmark::Counter(static_cast<double>(end.allocations -
+                                                 start_.allocations),
+                             ::benchmark::Counter::kAvgIterations);
+    state.counters["BytesAllocated"] = ::benchmark::Counter(
+        static_cast<double>(end.bytes - start_.bytes),
+        ::benchmark::Counter::kAvgIterations,
+        ::benchmark::Counter::OneK::kIs1024);
+    state.counters["PeakLiveBytes"] = ::benchmark::Counter(
+        static_cast<double>(end.peak_live_bytes > start_.live_bytes
+                                ? end.peak_live_bytes - start_.live_bytes
+                                : 0),
+        ::benchmark::Counter::kDefaults, ::benchmark::Counter::OneK::kIs1024);
+  }
+
+private:
+  allocation_stats start_;
+};
+
+} // namespace benchmark
+
+} // namespace alpaca
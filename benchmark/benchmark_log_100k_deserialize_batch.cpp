@@ -0,0 +1,55 @@
+#include <alpaca/batch.h>
+#include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
+#include "log.h"
+#include <random>
+#include <thread>
+
+std::random_device rd;
+std::default_random_engine eng(rd());
+
+// 100k independently framed log messages, decoded on 1..N threads
+static void BM_deserialize_batch_log_100k(benchmark::State &state) {
+  {
+    constexpr std::size_t count = 100000;
+    std::vector<std::vector<uint8_t>> frames(count);
+    std::size_t data_size = 0;
+    for (auto &frame : frames) {
+      data_size += alpaca::serialize(alpaca::benchmark::generate_log(eng), frame);
+    }
+
+    alpaca::thread_pool pool(state.range(0));
+    std::vector<alpaca::benchmark::Log> logs_recovered(count);
+    std::vector<std::error_code> error_codes;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      error_codes = alpaca::deserialize_batch<alpaca::benchmark::Log>(
+          frames, logs_recovered.begin(), pool);
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    bool success = true;
+    for (auto &ec : error_codes) {
+      success = success && !ec;
+    }
+
+    state.counters["Success"] = success;
+    state.counters["Threads"] = pool.concurrency();
+    state.counters["BytesOutput"] = data_size;
+    state.counters["Messages"] = benchmark::Counter(count, benchmark::Counter::kIsIterationInvariantRate);
+    state.counters["DataRate"] = benchmark::Counter(data_size, benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
+BENCHMARK(BM_deserialize_batch_log_100k)
+    ->DenseRange(1, std::max(1u, std::thread::hardware_concurrency()))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
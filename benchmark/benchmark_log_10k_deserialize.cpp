@@ -1,5 +1,7 @@
 #include <alpaca/alpaca.h>
 #include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
 #include "log.h"
 #include <random>
 
@@ -19,10 +21,15 @@ static void BM_deserialize_log_10k(benchmark::State &state) {
     std::error_code ec;
     alpaca::benchmark::Logs logs_recovered;
 
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
     for (auto _ : state) {
       // This code gets timed
       logs_recovered = alpaca::deserialize<alpaca::benchmark::Logs>(bytes, ec);
     }
+    perf.report(state);
+    allocations.report(state);
 
     state.counters["Success"] = ((bool)ec == false);
     state.counters["BytesOutput"] = data_size;
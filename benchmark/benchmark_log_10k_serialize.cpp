@@ -1,5 +1,7 @@
 #include <alpaca/alpaca.h>
 #include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
 #include "log.h"
 #include <random>
 
@@ -14,10 +16,15 @@ static void BM_serialize_log_10k(benchmark::State &state) {
     std::array<uint8_t, 1000000> bytes;
     std::size_t data_size = 0;
 
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
     for (auto _ : state) {
       // This code gets timed
       data_size = alpaca::serialize(logs, bytes);
     }
+    perf.report(state);
+    allocations.report(state);
 
     std::error_code ec;
     auto logs_recovered = alpaca::deserialize<alpaca::benchmark::Logs>(bytes, ec);
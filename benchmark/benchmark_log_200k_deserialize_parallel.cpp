@@ -0,0 +1,84 @@
+#include <alpaca/batch.h>
+#include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
+#include "log.h"
+#include <random>
+#include <thread>
+
+std::random_device rd;
+std::default_random_engine eng(rd());
+
+constexpr auto OPTIONS = alpaca::options::with_chunk_index;
+
+// one Logs struct with 200k entries, written with a chunk index and decoded
+// on 1..N threads
+static void BM_deserialize_parallel_log_200k(benchmark::State &state) {
+  {
+    alpaca::benchmark::Logs logs;
+    for (std::size_t i = 0; i < 200000; ++i) {
+      logs.logs.push_back(alpaca::benchmark::generate_log(eng));
+    }
+
+    std::vector<uint8_t> bytes;
+    auto data_size = alpaca::serialize<OPTIONS>(logs, bytes);
+
+    alpaca::thread_pool pool(state.range(0));
+    std::error_code ec;
+    alpaca::benchmark::Logs logs_recovered;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      logs_recovered = alpaca::deserialize_parallel<OPTIONS, alpaca::benchmark::Logs>(bytes, pool, ec);
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    state.counters["Success"] = ((bool)ec == false && logs_recovered.logs.size() == logs.logs.size());
+    state.counters["Threads"] = pool.concurrency();
+    state.counters["BytesOutput"] = data_size;
+    state.counters["DataRate"] = benchmark::Counter(data_size, benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
+static void BM_deserialize_log_200k(benchmark::State &state) {
+  {
+    alpaca::benchmark::Logs logs;
+    for (std::size_t i = 0; i < 200000; ++i) {
+      logs.logs.push_back(alpaca::benchmark::generate_log(eng));
+    }
+
+    std::vector<uint8_t> bytes;
+    auto data_size = alpaca::serialize(logs, bytes);
+
+    std::error_code ec;
+    alpaca::benchmark::Logs logs_recovered;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      // sequential decode without a chunk index, for comparison
+      logs_recovered = alpaca::deserialize<alpaca::benchmark::Logs>(bytes, ec);
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    state.counters["Success"] = ((bool)ec == false);
+    state.counters["BytesOutput"] = data_size;
+    state.counters["DataRate"] = benchmark::Counter(data_size, benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
+BENCHMARK(BM_deserialize_log_200k)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_deserialize_parallel_log_200k)
+    ->DenseRange(1, std::max(1u, std::thread::hardware_concurrency()))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
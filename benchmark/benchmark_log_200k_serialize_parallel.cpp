@@ -0,0 +1,79 @@
+#include <alpaca/batch.h>
+#include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
+#include "log.h"
+#include <random>
+#include <thread>
+
+std::random_device rd;
+std::default_random_engine eng(rd());
+
+// one Logs struct with 200k entries, encoded on 1..N threads
+static void BM_serialize_parallel_log_200k(benchmark::State &state) {
+  {
+    alpaca::benchmark::Logs logs;
+    for (std::size_t i = 0; i < 200000; ++i) {
+      logs.logs.push_back(alpaca::benchmark::generate_log(eng));
+    }
+
+    alpaca::thread_pool pool(state.range(0));
+    std::vector<uint8_t> bytes;
+    std::size_t data_size = 0;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      bytes.clear();
+      data_size = alpaca::serialize_parallel(logs, bytes, pool);
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    std::vector<uint8_t> expected;
+    alpaca::serialize(logs, expected);
+
+    state.counters["Success"] = (bytes == expected);
+    state.counters["Threads"] = pool.concurrency();
+    state.counters["BytesOutput"] = data_size;
+    state.counters["DataRate"] = benchmark::Counter(data_size, benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
+static void BM_serialize_log_200k(benchmark::State &state) {
+  {
+    alpaca::benchmark::Logs logs;
+    for (std::size_t i = 0; i < 200000; ++i) {
+      logs.logs.push_back(alpaca::benchmark::generate_log(eng));
+    }
+
+    std::vector<uint8_t> bytes;
+    std::size_t data_size = 0;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      // sequential encoding, for comparison
+      bytes.clear();
+      data_size = alpaca::serialize(logs, bytes);
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    state.counters["BytesOutput"] = data_size;
+    state.counters["DataRate"] = benchmark::Counter(data_size, benchmark::Counter::kIsIterationInvariantRate);
+  }
+}
+
+BENCHMARK(BM_serialize_log_200k)->UseRealTime()->Unit(benchmark::kMillisecond);
+
+BENCHMARK(BM_serialize_parallel_log_200k)
+    ->DenseRange(1, std::max(1u, std::thread::hardware_concurrency()))
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,87 @@
+#include <alpaca/async_file.h>
+#include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
+#include "log.h"
+#include <cstdio>
+#include <random>
+
+std::random_device rd;
+std::default_random_engine eng(rd());
+
+// time the caller spends saving a 200k-entry snapshot with std::ofstream
+static void BM_snapshot_ofstream_log_200k(benchmark::State &state) {
+  {
+    alpaca::benchmark::Logs logs;
+    for (std::size_t i = 0; i < 200000; ++i) {
+      logs.logs.push_back(alpaca::benchmark::generate_log(eng));
+    }
+
+    const auto path = "benchmark_snapshot_ofstream.bin";
+    std::size_t data_size = 0;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      std::ofstream os;
+      os.open(path, std::ios::out | std::ios::binary);
+      data_size = alpaca::serialize(logs, os);
+      os.close();
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    std::remove(path);
+    state.counters["BytesOutput"] = data_size;
+  }
+}
+
+// time the caller spends saving the same snapshot with async_file_writer,
+// i.e., serializing it and submitting the write
+static void BM_snapshot_async_file_log_200k(benchmark::State &state) {
+  {
+    alpaca::benchmark::Logs logs;
+    for (std::size_t i = 0; i < 200000; ++i) {
+      logs.logs.push_back(alpaca::benchmark::generate_log(eng));
+    }
+
+    const auto path = "benchmark_snapshot_async_file.bin";
+    alpaca::async_file_writer writer(state.range(0) == 1);
+    bool success = true;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      auto result = writer.save(logs, path);
+
+      // wait for the write outside of the timing, like a caller that saves
+      // much less often than the disk takes to write
+      state.PauseTiming();
+      success = success && !result.get();
+      state.ResumeTiming();
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    std::remove(path);
+    state.counters["Success"] = success;
+    state.counters["IoUring"] = writer.uses_io_uring();
+  }
+}
+
+BENCHMARK(BM_snapshot_ofstream_log_200k)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+// 1 = io_uring, 0 = pwrite fallback
+BENCHMARK(BM_snapshot_async_file_log_200k)
+    ->Arg(1)
+    ->Arg(0)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond);
+
+BENCHMARK_MAIN();
@@ -1,5 +1,7 @@
 #include <alpaca/alpaca.h>
 #include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
 #include "mesh.h"
 #include <random>
 
@@ -16,10 +18,15 @@ static void BM_serialize_mesh_125k(benchmark::State &state) {
     std::array<uint8_t, 6000024> bytes;
     std::size_t data_size = 0;
 
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
     for (auto _ : state) {
         // This code gets timed
         data_size = alpaca::serialize(m, bytes);
     }
+    perf.report(state);
+    allocations.report(state);
 
     std::error_code ec;
     auto m_recovered = alpaca::deserialize<alpaca::benchmark::Mesh>(bytes, ec);
@@ -1,5 +1,7 @@
 #include <alpaca/alpaca.h>
 #include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
 #include "log.h"
 #include <random>
 
@@ -23,11 +25,16 @@ static void BM_deserialize_minecraft_players_50(benchmark::State &state) {
     std::error_code ec;
     alpaca::benchmark::Players m_recovered;
 
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
     for (auto _ : state) {
       // This code gets timed
       // serialize
       m_recovered = alpaca::deserialize<OPTIONS, alpaca::benchmark::Players>(bytes, ec);
     }
+    perf.report(state);
+    allocations.report(state);
 
     state.counters["Success"] = ((bool)ec == false);
     state.counters["BytesOutput"] = data_size;
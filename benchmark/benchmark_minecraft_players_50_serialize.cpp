@@ -1,5 +1,7 @@
 #include <alpaca/alpaca.h>
 #include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
 #include "log.h"
 #include <random>
 
@@ -20,11 +22,16 @@ static void BM_serialize_minecraft_players_50(benchmark::State &state) {
 
     constexpr auto OPTIONS = alpaca::options::fixed_length_encoding;
 
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
     for (auto _ : state) {
       // This code gets timed
       // serialize
       data_size = alpaca::serialize<OPTIONS>(m, bytes);
     }
+    perf.report(state);
+    allocations.report(state);
 
     std::error_code ec;
     auto m_recovered = alpaca::deserialize<OPTIONS, alpaca::benchmark::Players>(bytes, ec);
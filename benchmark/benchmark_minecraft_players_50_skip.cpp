@@ -0,0 +1,81 @@
+#include <alpaca/alpaca.h>
+#include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
+#include "log.h"
+#include <random>
+
+std::random_device rd;
+std::default_random_engine eng(rd());
+std::uniform_real_distribution<float> real_distr(-1000.0f, 1000.0f);
+
+static void BM_skip_minecraft_players_50(benchmark::State &state) {
+  {
+    alpaca::benchmark::Players m;
+
+    for (std::size_t i = 0; i < 50; ++i) {
+      m.players.push_back(alpaca::benchmark::generate_player(eng));
+    }
+
+    std::array<uint8_t, 150000> bytes;
+    std::size_t data_size = alpaca::serialize(m, bytes);
+
+    std::error_code ec;
+    std::size_t byte_index = 0;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      // walk the input without constructing anything
+      byte_index = 0;
+      std::size_t end_index = data_size;
+      alpaca::skip<alpaca::benchmark::Players>(bytes, byte_index, end_index, ec);
+      benchmark::DoNotOptimize(byte_index);
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    state.counters["Success"] = ((bool)ec == false && byte_index == data_size);
+    state.counters["BytesOutput"] = data_size;
+    state.counters["DataRate"] = benchmark::Counter(data_size, benchmark::Counter::kIsRate);
+  }
+}
+
+static void BM_deserialize_minecraft_players_50(benchmark::State &state) {
+  {
+    alpaca::benchmark::Players m;
+
+    for (std::size_t i = 0; i < 50; ++i) {
+      m.players.push_back(alpaca::benchmark::generate_player(eng));
+    }
+
+    std::array<uint8_t, 150000> bytes;
+    std::size_t data_size = alpaca::serialize(m, bytes);
+
+    std::error_code ec;
+    alpaca::benchmark::Players m_recovered;
+
+    alpaca::benchmark::allocation_report allocations;
+
+    alpaca::benchmark::perf_report perf;
+    for (auto _ : state) {
+      // This code gets timed
+      // full decode of the same input, for comparison
+      m_recovered = alpaca::deserialize<alpaca::benchmark::Players>(bytes, data_size, ec);
+    }
+    perf.report(state);
+    allocations.report(state);
+
+    state.counters["Success"] = ((bool)ec == false);
+    state.counters["BytesOutput"] = data_size;
+    state.counters["Players"] = m_recovered.players.size();
+    state.counters["DataRate"] = benchmark::Counter(data_size, benchmark::Counter::kIsRate);
+  }
+}
+
+BENCHMARK(BM_skip_minecraft_players_50);
+BENCHMARK(BM_deserialize_minecraft_players_50);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,256 @@
+#include <alpaca/alpaca.h>
+#include <benchmark/benchmark.h>
+#include "allocation_report.h"
+#include "perf_report.h"
+#include <utility>
+
+// One benchmark per supported type, crossed with every combination of
+// fixed_length_encoding, big_endian, with_version and with_checksum, for
+// std::vector and std::array outputs
+//
+// Names are <serialize|deserialize>/<output>/<type>/<options>, e.g.,
+//   serialize/vector/string_64/fixed_length_encoding,with_checksum
+// so a single row or column can be selected with --benchmark_filter
+
+namespace {
+
+template <typename T> struct Field {
+  T value;
+};
+
+#define ALPACA_BENCHMARK_CASE(NAME, TYPE, ...)                                 \
+  struct NAME {                                                                \
+    using type = TYPE;                                                         \
+    static const char *name() { return #NAME; }                                \
+    static Field<type> make() { return {__VA_ARGS__}; }                        \
+  };
+
+// varint widths, see detail/variable_length_encoding.h
+ALPACA_BENCHMARK_CASE(uint32_1byte, uint32_t, 100)
+ALPACA_BENCHMARK_CASE(uint32_3byte, uint32_t, 100000)
+ALPACA_BENCHMARK_CASE(uint32_5byte, uint32_t, 4000000000u)
+ALPACA_BENCHMARK_CASE(uint64_9byte, uint64_t, 1ull << 60)
+ALPACA_BENCHMARK_CASE(int32_negative, int32_t, -100000)
+ALPACA_BENCHMARK_CASE(float32, float, 3.14159f)
+ALPACA_BENCHMARK_CASE(float64, double, 2.718281828)
+
+ALPACA_BENCHMARK_CASE(string_8, std::string, std::string(8, 'a'))
+ALPACA_BENCHMARK_CASE(string_64, std::string, std::string(64, 'a'))
+ALPACA_BENCHMARK_CASE(string_1024, std::string, std::string(1024, 'a'))
+
+template <typename T> std::vector<T> iota_vector(std::size_t size) {
+  std::vector<T> result;
+  for (std::size_t i = 0; i < size; ++i) {
+    result.push_back(static_cast<T>(i * 997));
+  }
+  return result;
+}
+
+std::vector<std::string> strings(std::size_t size) {
+  std::vector<std::string> result;
+  for (std::size_t i = 0; i < size; ++i) {
+    result.push_back("key_" + std::to_string(i));
+  }
+  return result;
+}
+
+template <typename Container> Container fill_set(std::size_t size) {
+  Container result;
+  for (std::size_t i = 0; i < size; ++i) {
+    result.insert(static_cast<int>(i * 997));
+  }
+  return result;
+}
+
+template <typename Container> Container fill_map(std::size_t size) {
+  Container result;
+  for (std::size_t i = 0; i < size; ++i) {
+    result.insert({"key_" + std::to_string(i), static_cast<int>(i)});
+  }
+  return result;
+}
+
+// the macro cannot take types with commas
+using uint32_array_128 = std::array<uint32_t, 128>;
+using string_int_map = std::map<std::string, int>;
+using string_int_unordered_map = std::unordered_map<std::string, int>;
+using int_string_double_variant = std::variant<int, std::string, double>;
+using int_float_string_tuple = std::tuple<int, float, std::string>;
+
+ALPACA_BENCHMARK_CASE(vector_uint32_256, std::vector<uint32_t>,
+                      iota_vector<uint32_t>(256))
+ALPACA_BENCHMARK_CASE(vector_float_256, std::vector<float>,
+                      iota_vector<float>(256))
+ALPACA_BENCHMARK_CASE(vector_string_64, std::vector<std::string>, strings(64))
+ALPACA_BENCHMARK_CASE(array_uint32_128, uint32_array_128, {})
+ALPACA_BENCHMARK_CASE(map_string_int_64, string_int_map,
+                      fill_map<string_int_map>(64))
+ALPACA_BENCHMARK_CASE(unordered_map_string_int_64, string_int_unordered_map,
+                      fill_map<string_int_unordered_map>(64))
+ALPACA_BENCHMARK_CASE(set_int_256, std::set<int>, fill_set<std::set<int>>(256))
+ALPACA_BENCHMARK_CASE(unordered_set_int_256, std::unordered_set<int>,
+                      fill_set<std::unordered_set<int>>(256))
+ALPACA_BENCHMARK_CASE(variant_string, int_string_double_variant,
+                      std::string(16, 'a'))
+ALPACA_BENCHMARK_CASE(optional_uint64, std::optional<uint64_t>, 1ull << 40)
+ALPACA_BENCHMARK_CASE(unique_ptr_uint64, std::unique_ptr<uint64_t>,
+                      std::make_unique<uint64_t>(1ull << 40))
+ALPACA_BENCHMARK_CASE(tuple_int_float_string, int_float_string_tuple,
+                      int_float_string_tuple{5, 0.5f, std::string(16, 'a')})
+ALPACA_BENCHMARK_CASE(bitset_256, std::bitset<256>,
+                      std::bitset<256>(0xf0f0f0f0f0f0f0f0ull))
+ALPACA_BENCHMARK_CASE(duration_ns, std::chrono::nanoseconds,
+                      std::chrono::nanoseconds(123456789))
+ALPACA_BENCHMARK_CASE(path, std::filesystem::path,
+                      std::filesystem::path("/usr/local/share/alpaca/a.bin"))
+
+#undef ALPACA_BENCHMARK_CASE
+
+// large enough for every case
+using array_output = std::array<uint8_t, 1 << 16>;
+
+std::string options_name(alpaca::options value) {
+  const std::pair<alpaca::options, const char *> flags[] = {
+      {alpaca::options::fixed_length_encoding, "fixed_length_encoding"},
+      {alpaca::options::big_endian, "big_endian"},
+      {alpaca::options::with_version, "with_version"},
+      {alpaca::options::with_checksum, "with_checksum"}};
+
+  std::string result;
+  for (const auto &flag : flags) {
+    if (static_cast<int>(value) & static_cast<int>(flag.first)) {
+      result += (result.empty() ? "" : ",") + std::string(flag.second);
+    }
+  }
+  return result.empty() ? "none" : result;
+}
+
+template <alpaca::options O, typename Case>
+void BM_serialize_vector(benchmark::State &state) {
+  const auto input = Case::make();
+  std::vector<uint8_t> bytes;
+  std::size_t data_size = 0;
+
+  alpaca::benchmark::allocation_report allocations;
+
+  alpaca::benchmark::perf_report perf;
+  for (auto _ : state) {
+    // This code gets timed
+    bytes.clear();
+    data_size = alpaca::serialize<O>(input, bytes);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  perf.report(state);
+  allocations.report(state);
+
+  state.counters["BytesOutput"] = data_size;
+  state.counters["DataRate"] =
+      benchmark::Counter(data_size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <alpaca::options O, typename Case>
+void BM_serialize_array(benchmark::State &state) {
+  const auto input = Case::make();
+  static array_output bytes;
+  std::size_t data_size = 0;
+
+  alpaca::benchmark::allocation_report allocations;
+
+  alpaca::benchmark::perf_report perf;
+  for (auto _ : state) {
+    // This code gets timed
+    data_size = alpaca::serialize<O>(input, bytes);
+    benchmark::DoNotOptimize(bytes.data());
+  }
+  perf.report(state);
+  allocations.report(state);
+
+  state.counters["BytesOutput"] = data_size;
+  state.counters["DataRate"] =
+      benchmark::Counter(data_size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <alpaca::options O, typename Case, typename Container>
+void BM_deserialize(benchmark::State &state, Container &bytes) {
+  using T = Field<typename Case::type>;
+  const std::size_t data_size = alpaca::serialize<O>(Case::make(), bytes);
+
+  std::error_code ec;
+  alpaca::benchmark::allocation_report allocations;
+  alpaca::benchmark::perf_report perf;
+  for (auto _ : state) {
+    // This code gets timed
+    auto output = alpaca::deserialize<O, T>(bytes, data_size, ec);
+    benchmark::DoNotOptimize(output);
+  }
+  perf.report(state);
+  allocations.report(state);
+
+  state.counters["Success"] = ((bool)ec == false);
+  state.counters["BytesOutput"] = data_size;
+  state.counters["DataRate"] =
+      benchmark::Counter(data_size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <alpaca::options O, typename Case>
+void BM_deserialize_vector(benchmark::State &state) {
+  std::vector<uint8_t> bytes;
+  BM_deserialize<O, Case>(state, bytes);
+}
+
+template <alpaca::options O, typename Case>
+void BM_deserialize_array(benchmark::State &state) {
+  static array_output bytes;
+  BM_deserialize<O, Case>(state, bytes);
+}
+
+template <typename Case, int... I>
+void register_case(std::integer_sequence<int, I...>) {
+  const auto name = [](const char *operation, const char *output, int value) {
+    return std::string(operation) + "/" + output + "/" + Case::name() + "/" +
+           options_name(static_cast<alpaca::options>(value));
+  };
+
+  (benchmark::RegisterBenchmark(
+       name("serialize", "vector", I).c_str(),
+       BM_serialize_vector<static_cast<alpaca::options>(I), Case>),
+   ...);
+  (benchmark::RegisterBenchmark(
+       name("serialize", "array", I).c_str(),
+       BM_serialize_array<static_cast<alpaca::options>(I), Case>),
+   ...);
+  (benchmark::RegisterBenchmark(
+       name("deserialize", "vector", I).c_str(),
+       BM_deserialize_vector<static_cast<alpaca::options>(I), Case>),
+   ...);
+  (benchmark::RegisterBenchmark(
+       name("deserialize", "array", I).c_str(),
+       BM_deserialize_array<static_cast<alpaca::options>(I), Case>),
+   ...);
+}
+
+// big_endian = 1, fixed_length_encoding = 2, with_version = 4,
+// with_checksum = 8
+template <typename... Cases> void register_cases() {
+  (register_case<Cases>(std::make_integer_sequence<int, 16>{}), ...);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_cases<uint32_1byte, uint32_3byte, uint32_5byte, uint64_9byte,
+                 int32_negative, float32, float64, string_8, string_64,
+                 string_1024, vector_uint32_256, vector_float_256,
+                 vector_string_64, array_uint32_128, map_string_int_64,
+                 unordered_map_string_int_64, set_int_256,
+                 unordered_set_int_256, variant_string, optional_uint64,
+                 unique_ptr_uint64, tuple_int_float_string, bitset_256,
+                 duration_ns, path>();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
@@ -0,0 +1,160 @@
+#include "../allocation_report.h"
+#include "../log.h"
+#include "../mesh.h"
+#include "../perf_report.h"
+#include "formats.h"
+#include <benchmark/benchmark.h>
+#include <random>
+
+#ifdef ALPACA_COMPARE_WITH_PROTOBUF
+#include "protobuf_format.h"
+#endif
+#ifdef ALPACA_COMPARE_WITH_CEREAL
+#include "cereal_format.h"
+#endif
+#ifdef ALPACA_COMPARE_WITH_ZPP_BITS
+#include "zpp_bits_format.h"
+#endif
+
+// Runs the Logs, Mesh and Players data sets through alpaca and every other
+// format found at configure time, reporting the encoded size, encode and
+// decode time, heap allocations per call (see allocation_report.h), and
+// hardware counters when enabled (see perf_report.h)
+//
+// Names are <encode|decode>/<data set>/<format>, e.g., decode/mesh_125k/alpaca
+
+namespace {
+
+using namespace alpaca::benchmark;
+
+std::default_random_engine eng(42);
+std::uniform_real_distribution<float> real_distr(-1000.0f, 1000.0f);
+
+const Logs &logs_10k() {
+  static const Logs logs = generate_logs(eng);
+  return logs;
+}
+
+const Mesh &mesh_125k() {
+  static const Mesh mesh = [] {
+    Mesh m;
+    generate_mesh<125000>(m, eng, real_distr);
+    return m;
+  }();
+  return mesh;
+}
+
+const Players &players_50() {
+  static const Players players = [] {
+    Players m;
+    for (std::size_t i = 0; i < 50; ++i) {
+      m.players.push_back(generate_player(eng));
+    }
+    return m;
+  }();
+  return players;
+}
+
+// same data set, as far as alpaca can tell
+template <typename T> bool same(const T &lhs, const T &rhs) {
+  std::vector<uint8_t> lhs_bytes, rhs_bytes;
+  alpaca::serialize(lhs, lhs_bytes);
+  alpaca::serialize(rhs, rhs_bytes);
+  return lhs_bytes == rhs_bytes;
+}
+
+template <typename Format, typename T>
+void BM_encode(benchmark::State &state, const T &(*dataset)()) {
+  const auto &input = dataset();
+  Format format;
+  std::size_t data_size = format.encode(input);
+
+  alpaca::benchmark::allocation_report allocations;
+
+  alpaca::benchmark::perf_report perf;
+  for (auto _ : state) {
+    // This code gets timed
+    data_size = format.encode(input);
+  }
+  perf.report(state);
+  allocations.report(state);
+
+  state.counters["BytesOutput"] = data_size;
+  state.counters["DataRate"] = benchmark::Counter(
+      data_size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <typename Format, typename T>
+void BM_decode(benchmark::State &state, const T &(*dataset)()) {
+  const auto &input = dataset();
+  Format format;
+  const std::size_t data_size = format.encode(input);
+
+  bool success = true;
+  {
+    T output{};
+    success = format.decode(output) && same(input, output);
+  }
+
+  alpaca::benchmark::allocation_report allocations;
+
+  alpaca::benchmark::perf_report perf;
+  for (auto _ : state) {
+    // This code gets timed
+    T output{};
+    success = format.decode(output) && success;
+    benchmark::DoNotOptimize(output);
+  }
+  perf.report(state);
+  allocations.report(state);
+
+  state.counters["Success"] = success;
+  state.counters["BytesOutput"] = data_size;
+  state.counters["DataRate"] = benchmark::Counter(
+      data_size, benchmark::Counter::kIsIterationInvariantRate);
+}
+
+template <typename T, typename... Formats>
+void register_dataset(const char *name, const T &(*dataset)()) {
+  (benchmark::RegisterBenchmark(
+       (std::string("encode/") + name + "/" + Formats::name).c_str(),
+       BM_encode<Formats, T>, dataset),
+   ...);
+  (benchmark::RegisterBenchmark(
+       (std::string("decode/") + name + "/" + Formats::name).c_str(),
+       BM_decode<Formats, T>, dataset),
+   ...);
+}
+
+template <typename... Formats> void register_formats() {
+  register_dataset<Logs, Formats...>("logs_10k", logs_10k);
+  register_dataset<Mesh, Formats...>("mesh_125k", mesh_125k);
+  register_dataset<Players, Formats...>("players_50", players_50);
+}
+
+} // namespace
+
+int main(int argc, char **argv) {
+  register_formats<memcpy_format, alpaca_format<>,
+                   alpaca_format<alpaca::options::fixed_length_encoding>
+#ifdef ALPACA_COMPARE_WITH_PROTOBUF
+                   ,
+                   protobuf_format
+#endif
+#ifdef ALPACA_COMPARE_WITH_CEREAL
+                   ,
+                   cereal_format
+#endif
+#ifdef ALPACA_COMPARE_WITH_ZPP_BITS
+                   ,
+                   zpp_bits_format
+#endif
+                   >();
+
+  benchmark::Initialize(&argc, argv);
+  if (benchmark::ReportUnrecognizedArguments(argc, argv)) {
+    return 1;
+  }
+  benchmark::RunSpecifiedBenchmarks();
+  benchmark::Shutdown();
+}
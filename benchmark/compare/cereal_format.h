@@ -0,0 +1,58 @@
+#pragma once
+#include "../log.h"
+#include "../mesh.h"
+#include <alpaca/alpaca.h>
+#include <cereal/archives/binary.hpp>
+#include <cereal/types/string.hpp>
+#include <cereal/types/vector.hpp>
+#include <sstream>
+#include <string>
+
+namespace alpaca {
+
+namespace benchmark {
+
+template <typename Archive, typename T, std::size_t... I>
+void serialize_fields(Archive &archive, T &value, std::index_sequence<I...>) {
+  archive(detail::get<I>(value)...);
+}
+
+// found by argument-dependent lookup for every struct of the data sets
+template <typename Archive, typename T>
+typename std::enable_if<std::is_class_v<T> && std::is_aggregate_v<T>>::type
+serialize(Archive &archive, T &value) {
+  serialize_fields(archive, value,
+                   std::make_index_sequence<
+                       detail::aggregate_arity<T>::size()>{});
+}
+
+struct cereal_format {
+  static constexpr const char *name = "cereal";
+
+  template <typename T> std::size_t encode(const T &input) {
+    std::ostringstream stream;
+    {
+      cereal::BinaryOutputArchive archive(stream);
+      archive(input);
+    }
+    bytes = std::move(stream).str();
+    return bytes.size();
+  }
+
+  template <typename T> bool decode(T &output) {
+    std::istringstream stream(bytes);
+    try {
+      cereal::BinaryInputArchive archive(stream);
+      archive(output);
+    } catch (const cereal::Exception &) {
+      return false;
+    }
+    return true;
+  }
+
+  std::string bytes;
+};
+
+} // namespace benchmark
+
+} // namespace alpaca
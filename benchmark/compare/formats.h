@@ -0,0 +1,149 @@
+#pragma once
+#include <alpaca/alpaca.h>
+#include <cstring>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace alpaca {
+
+namespace benchmark {
+
+// Every format has a name, and encode/decode between a data set and the
+// bytes it keeps, e.g.,
+//
+//   struct my_format {
+//     static constexpr const char *name = "my_format";
+//     template <typename T> std::size_t encode(const T &input);
+//     template <typename T> bool decode(T &output);
+//   };
+
+template <options O = options::none> struct alpaca_format {
+  static constexpr const char *name =
+      O == options::none ? "alpaca" : "alpaca_fixed_length";
+
+  template <typename T> std::size_t encode(const T &input) {
+    bytes.clear();
+    return alpaca::serialize<O>(input, bytes);
+  }
+
+  template <typename T> bool decode(T &output) {
+    std::error_code ec;
+    output = alpaca::deserialize<O, T>(bytes, ec);
+    return !ec;
+  }
+
+  std::vector<uint8_t> bytes;
+};
+
+// Lower bound: trivially copyable values, and vectors of them, are copied
+// as is, strings and other vectors are prefixed with their size
+// No versioning, no validation beyond bounds checks, native byte order
+struct memcpy_format {
+  static constexpr const char *name = "memcpy";
+
+  template <typename T> std::size_t encode(const T &input) {
+    bytes.clear();
+    write(input);
+    return bytes.size();
+  }
+
+  template <typename T> bool decode(T &output) {
+    index = 0;
+    return read(output);
+  }
+
+  std::vector<uint8_t> bytes;
+  std::size_t index{0};
+
+private:
+  void write_raw(const void *data, std::size_t size) {
+    const auto *first = static_cast<const uint8_t *>(data);
+    bytes.insert(bytes.end(), first, first + size);
+  }
+
+  bool read_raw(void *data, std::size_t size) {
+    if (size > bytes.size() - index) {
+      return false;
+    }
+    std::memcpy(data, bytes.data() + index, size);
+    index += size;
+    return true;
+  }
+
+  template <typename T> void write(const T &input) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      write_raw(&input, sizeof(T));
+    } else {
+      write_fields(input, std::make_index_sequence<
+                              detail::aggregate_arity<T>::size()>{});
+    }
+  }
+
+  void write(const std::string &input) {
+    write(input.size());
+    write_raw(input.data(), input.size());
+  }
+
+  template <typename T> void write(const std::vector<T> &input) {
+    write(input.size());
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      write_raw(input.data(), input.size() * sizeof(T));
+    } else {
+      for (const auto &element : input) {
+        write(element);
+      }
+    }
+  }
+
+  template <typename T, std::size_t... I>
+  void write_fields(const T &input, std::index_sequence<I...>) {
+    (write(detail::get<I>(input)), ...);
+  }
+
+  template <typename T> bool read(T &output) {
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      return read_raw(&output, sizeof(T));
+    } else {
+      return read_fields(output, std::make_index_sequence<
+                                     detail::aggregate_arity<T>::size()>{});
+    }
+  }
+
+  bool read(std::string &output) {
+    std::size_t size = 0;
+    if (!read(size) || size > bytes.size() - index) {
+      return false;
+    }
+    output.assign(reinterpret_cast<const char *>(bytes.data() + index), size);
+    index += size;
+    return true;
+  }
+
+  template <typename T> bool read(std::vector<T> &output) {
+    std::size_t size = 0;
+    if (!read(size) || size > bytes.size() - index) {
+      return false;
+    }
+    output.resize(size);
+    if constexpr (std::is_trivially_copyable_v<T>) {
+      return read_raw(output.data(), size * sizeof(T));
+    } else {
+      for (auto &element : output) {
+        if (!read(element)) {
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+
+  template <typename T, std::size_t... I>
+  bool read_fields(T &output, std::index_sequence<I...>) {
+    return (read(detail::get<I>(output)) && ...);
+  }
+};
+
+} // namespace benchmark
+
+} // namespace alpaca
@@ -0,0 +1,341 @@
+#pragma once
+#include "../log.h"
+#include "../mesh.h"
+#include "datasets.pb.h"
+#include <string>
+
+namespace alpaca {
+
+namespace benchmark {
+
+// Conversions between the data sets and the messages of datasets.proto
+// Encoding includes filling the message, decoding includes reading it back,
+// so that every format starts from and ends with the same C++ structs
+
+inline void to_pb(const Address &in, pb::Address *out) {
+  out->set_x0(in.x0);
+  out->set_x1(in.x1);
+  out->set_x2(in.x2);
+  out->set_x3(in.x3);
+}
+
+inline void from_pb(const pb::Address &in, Address &out) {
+  out = Address{in.x0(), in.x1(), in.x2(), in.x3()};
+}
+
+inline void to_pb(const Log &in, pb::Log *out) {
+  to_pb(in.address, out->mutable_address());
+  out->set_identity(in.identity);
+  out->set_userid(in.userid);
+  out->set_date(in.date);
+  out->set_request(in.request);
+  out->set_code(in.code);
+  out->set_size(in.size);
+}
+
+inline void from_pb(const pb::Log &in, Log &out) {
+  from_pb(in.address(), out.address);
+  out.identity = in.identity();
+  out.userid = in.userid();
+  out.date = in.date();
+  out.request = in.request();
+  out.code = in.code();
+  out.size = in.size();
+}
+
+inline void to_pb(const Logs &in, pb::Logs *out) {
+  out->mutable_logs()->Reserve(static_cast<int>(in.logs.size()));
+  for (const auto &log : in.logs) {
+    to_pb(log, out->add_logs());
+  }
+}
+
+inline void from_pb(const pb::Logs &in, Logs &out) {
+  out.logs.resize(static_cast<std::size_t>(in.logs_size()));
+  for (int i = 0; i < in.logs_size(); ++i) {
+    from_pb(in.logs(i), out.logs[static_cast<std::size_t>(i)]);
+  }
+}
+
+inline void to_pb(const Vector3 &in, pb::Vector3 *out) {
+  out->set_x(in.x);
+  out->set_y(in.y);
+  out->set_z(in.z);
+}
+
+inline void from_pb(const pb::Vector3 &in, Vector3 &out) {
+  out = Vector3{in.x(), in.y(), in.z()};
+}
+
+inline void to_pb(const Mesh &in, pb::Mesh *out) {
+  out->mutable_triangles()->Reserve(static_cast<int>(in.triangles.size()));
+  for (const auto &triangle : in.triangles) {
+    auto *t = out->add_triangles();
+    to_pb(triangle.v0, t->mutable_v0());
+    to_pb(triangle.v1, t->mutable_v1());
+    to_pb(triangle.v2, t->mutable_v2());
+    to_pb(triangle.normal, t->mutable_normal());
+  }
+}
+
+inline void from_pb(const pb::Mesh &in, Mesh &out) {
+  out.triangles.resize(static_cast<std::size_t>(in.triangles_size()));
+  for (int i = 0; i < in.triangles_size(); ++i) {
+    const auto &t = in.triangles(i);
+    auto &triangle = out.triangles[static_cast<std::size_t>(i)];
+    from_pb(t.v0(), triangle.v0);
+    from_pb(t.v1(), triangle.v1);
+    from_pb(t.v2(), triangle.v2);
+    from_pb(t.normal(), triangle.normal);
+  }
+}
+
+inline void to_pb(const Item &in, pb::Item *out) {
+  out->set_count(in.count);
+  out->set_slot(in.slot);
+  out->set_id(in.id);
+}
+
+inline void from_pb(const pb::Item &in, Item &out) {
+  out.count = in.count();
+  out.slot = in.slot();
+  out.id = in.id();
+}
+
+inline void to_pb(const Abilities &in, pb::Abilities *out) {
+  out->set_walk_speed(in.walk_speed);
+  out->set_fly_speed(in.fly_speed);
+  out->set_may_fly(in.may_fly);
+  out->set_flying(in.flying);
+  out->set_invulnerable(in.invulnerable);
+  out->set_may_build(in.may_build);
+  out->set_instabuild(in.instabuild);
+}
+
+inline void from_pb(const pb::Abilities &in, Abilities &out) {
+  out = Abilities{in.walk_speed(), in.fly_speed(),    in.may_fly(),
+                  in.flying(),     in.invulnerable(), in.may_build(),
+                  in.instabuild()};
+}
+
+inline void to_pb(const Vector3d &in, pb::Vector3d *out) {
+  out->set_x(in.x);
+  out->set_y(in.y);
+  out->set_z(in.z);
+}
+
+inline void from_pb(const pb::Vector3d &in, Vector3d &out) {
+  out = Vector3d{in.x(), in.y(), in.z()};
+}
+
+inline void to_pb(const Uuid &in, pb::Uuid *out) {
+  out->set_x0(in.x0);
+  out->set_x1(in.x1);
+  out->set_x2(in.x2);
+  out->set_x3(in.x3);
+}
+
+inline void from_pb(const pb::Uuid &in, Uuid &out) {
+  out = Uuid{in.x0(), in.x1(), in.x2(), in.x3()};
+}
+
+inline void to_pb(const Entity &in, pb::Entity *out) {
+  out->set_id(in.id);
+  to_pb(in.pos, out->mutable_pos());
+  to_pb(in.motion, out->mutable_motion());
+  out->mutable_rotation()->set_x(in.rotation.x);
+  out->mutable_rotation()->set_y(in.rotation.y);
+  out->set_fall_distance(in.fall_distance);
+  out->set_fire(in.fire);
+  out->set_air(in.air);
+  out->set_on_ground(in.on_ground);
+  out->set_no_gravity(in.no_gravity);
+  out->set_invulnerable(in.invulnerable);
+  out->set_portal_cooldown(in.portal_cooldown);
+  to_pb(in.uuid, out->mutable_uuid());
+  out->set_custom_name(in.custom_name);
+  out->set_custom_name_visible(in.custom_name_visible);
+  out->set_silent(in.silent);
+  out->set_glowing(in.glowing);
+}
+
+inline void from_pb(const pb::Entity &in, Entity &out) {
+  out.id = in.id();
+  from_pb(in.pos(), out.pos);
+  from_pb(in.motion(), out.motion);
+  out.rotation = Vector2f{in.rotation().x(), in.rotation().y()};
+  out.fall_distance = in.fall_distance();
+  out.fire = in.fire();
+  out.air = in.air();
+  out.on_ground = in.on_ground();
+  out.no_gravity = in.no_gravity();
+  out.invulnerable = in.invulnerable();
+  out.portal_cooldown = in.portal_cooldown();
+  from_pb(in.uuid(), out.uuid);
+  out.custom_name = in.custom_name();
+  out.custom_name_visible = in.custom_name_visible();
+  out.silent = in.silent();
+  out.glowing = in.glowing();
+}
+
+inline void to_pb(const RecipeBook &in, pb::RecipeBook *out) {
+  for (const auto &recipe : in.recipes) {
+    out->add_recipes(recipe);
+  }
+  for (const auto &recipe : in.to_be_displayed) {
+    out->add_to_be_displayed(recipe);
+  }
+  out->set_is_filtering_craftable(in.is_filtering_craftable);
+  out->set_is_gui_open(in.is_gui_open);
+  out->set_is_furnace_filtering_craftable(in.is_furnace_filtering_craftable);
+  out->set_is_furnace_gui_open(in.is_furnace_gui_open);
+  out->set_is_blasting_furnace_filtering_craftable(
+      in.is_blasting_furnace_filtering_craftable);
+  out->set_is_blasting_furnace_gui_open(in.is_blasting_furnace_gui_open);
+  out->set_is_smoker_filtering_craftable(in.is_smoker_filtering_craftable);
+  out->set_is_smoker_gui_open(in.is_smoker_gui_open);
+}
+
+inline void from_pb(const pb::RecipeBook &in, RecipeBook &out) {
+  out.recipes.assign(in.recipes().begin(), in.recipes().end());
+  out.to_be_displayed.assign(in.to_be_displayed().begin(),
+                             in.to_be_displayed().end());
+  out.is_filtering_craftable = in.is_filtering_craftable();
+  out.is_gui_open = in.is_gui_open();
+  out.is_furnace_filtering_craftable = in.is_furnace_filtering_craftable();
+  out.is_furnace_gui_open = in.is_furnace_gui_open();
+  out.is_blasting_furnace_filtering_craftable =
+      in.is_blasting_furnace_filtering_craftable();
+  out.is_blasting_furnace_gui_open = in.is_blasting_furnace_gui_open();
+  out.is_smoker_filtering_craftable = in.is_smoker_filtering_craftable();
+  out.is_smoker_gui_open = in.is_smoker_gui_open();
+}
+
+inline void to_pb(const Player &in, pb::Player *out) {
+  out->set_game_type(static_cast<pb::GameType>(in.game_type));
+  out->set_previous_game_type(
+      static_cast<pb::GameType>(in.previous_game_type));
+  out->set_score(in.score);
+  out->set_dimension(in.dimension);
+  out->set_selected_item_slot(in.selected_item_slot);
+  to_pb(in.selected_item, out->mutable_selected_item());
+  out->set_spawn_dimension(in.spawn_dimension);
+  out->set_spawn_x(in.spawn_x);
+  out->set_spawn_y(in.spawn_y);
+  out->set_spawn_z(in.spawn_z);
+  out->set_spawn_forced(in.spawn_forced);
+  out->set_sleep_timer(in.sleep_timer);
+  out->set_food_exhaustion_level(in.food_exhaustion_level);
+  out->set_food_saturation_level(in.food_saturation_level);
+  out->set_food_tick_timer(in.food_tick_timer);
+  out->set_xp_level(in.xp_level);
+  out->set_xp_p(in.xp_p);
+  out->set_xp_total(in.xp_total);
+  out->set_xp_seed(in.xp_seed);
+  for (const auto &item : in.inventory) {
+    to_pb(item, out->add_inventory());
+  }
+  for (const auto &item : in.ender_items) {
+    to_pb(item, out->add_ender_items());
+  }
+  to_pb(in.abilities, out->mutable_abilities());
+  to_pb(in.entered_nether_position, out->mutable_entered_nether_position());
+  to_pb(in.root_vehicle.uuid, out->mutable_root_vehicle()->mutable_uuid());
+  to_pb(in.root_vehicle.entity,
+        out->mutable_root_vehicle()->mutable_entity());
+  to_pb(in.shoulder_entity_left, out->mutable_shoulder_entity_left());
+  to_pb(in.shoulder_entity_right, out->mutable_shoulder_entity_right());
+  out->set_seen_credits(in.seen_credits);
+  to_pb(in.recipe_book, out->mutable_recipe_book());
+}
+
+inline void from_pb(const pb::Player &in, Player &out) {
+  out.game_type = static_cast<GameType>(in.game_type());
+  out.previous_game_type = static_cast<GameType>(in.previous_game_type());
+  out.score = in.score();
+  out.dimension = in.dimension();
+  out.selected_item_slot = in.selected_item_slot();
+  from_pb(in.selected_item(), out.selected_item);
+  out.spawn_dimension = in.spawn_dimension();
+  out.spawn_x = in.spawn_x();
+  out.spawn_y = in.spawn_y();
+  out.spawn_z = in.spawn_z();
+  out.spawn_forced = in.spawn_forced();
+  out.sleep_timer = in.sleep_timer();
+  out.food_exhaustion_level = in.food_exhaustion_level();
+  out.food_saturation_level = in.food_saturation_level();
+  out.food_tick_timer = in.food_tick_timer();
+  out.xp_level = in.xp_level();
+  out.xp_p = in.xp_p();
+  out.xp_total = in.xp_total();
+  out.xp_seed = in.xp_seed();
+  out.inventory.resize(static_cast<std::size_t>(in.inventory_size()));
+  for (int i = 0; i < in.inventory_size(); ++i) {
+    from_pb(in.inventory(i), out.inventory[static_cast<std::size_t>(i)]);
+  }
+  out.ender_items.resize(static_cast<std::size_t>(in.ender_items_size()));
+  for (int i = 0; i < in.ender_items_size(); ++i) {
+    from_pb(in.ender_items(i), out.ender_items[static_cast<std::size_t>(i)]);
+  }
+  from_pb(in.abilities(), out.abilities);
+  from_pb(in.entered_nether_position(), out.entered_nether_position);
+  from_pb(in.root_vehicle().uuid(), out.root_vehicle.uuid);
+  from_pb(in.root_vehicle().entity(), out.root_vehicle.entity);
+  from_pb(in.shoulder_entity_left(), out.shoulder_entity_left);
+  from_pb(in.shoulder_entity_right(), out.shoulder_entity_right);
+  out.seen_credits = in.seen_credits();
+  from_pb(in.recipe_book(), out.recipe_book);
+}
+
+inline void to_pb(const Players &in, pb::Players *out) {
+  out->mutable_players()->Reserve(static_cast<int>(in.players.size()));
+  for (const auto &player : in.players) {
+    to_pb(player, out->add_players());
+  }
+}
+
+inline void from_pb(const pb::Players &in, Players &out) {
+  out.players.resize(static_cast<std::size_t>(in.players_size()));
+  for (int i = 0; i < in.players_size(); ++i) {
+    from_pb(in.players(i), out.players[static_cast<std::size_t>(i)]);
+  }
+}
+
+template <typename T> struct pb_message;
+template <> struct pb_message<Logs> { using type = pb::Logs; };
+template <> struct pb_message<Mesh> { using type = pb::Mesh; };
+template <> struct pb_message<Players> { using type = pb::Players; };
+
+// The message is kept between calls, as protobuf recommends, so that its
+// memory is reused
+struct protobuf_format {
+  static constexpr const char *name = "protobuf";
+
+  template <typename T> std::size_t encode(const T &input) {
+    auto &message = get_message<T>();
+    message.Clear();
+    to_pb(input, &message);
+    message.SerializeToString(&bytes);
+    return bytes.size();
+  }
+
+  template <typename T> bool decode(T &output) {
+    auto &message = get_message<T>();
+    if (!message.ParseFromString(bytes)) {
+      return false;
+    }
+    from_pb(message, output);
+    return true;
+  }
+
+  template <typename T> typename pb_message<T>::type &get_message() {
+    static thread_local typename pb_message<T>::type message;
+    return message;
+  }
+
+  std::string bytes;
+};
+
+} // namespace benchmark
+
+} // namespace alpaca
@@ -0,0 +1,33 @@
+#pragma once
+#include <zpp_bits.h>
+#include <cstddef>
+#include <vector>
+
+namespace alpaca {
+
+namespace benchmark {
+
+// zpp_bits serializes aggregates without any glue code
+struct zpp_bits_format {
+  static constexpr const char *name = "zpp_bits";
+
+  template <typename T> std::size_t encode(const T &input) {
+    bytes.clear();
+    zpp::bits::out out(bytes);
+    if (zpp::bits::failure(out(input))) {
+      return 0;
+    }
+    return out.position();
+  }
+
+  template <typename T> bool decode(T &output) {
+    zpp::bits::in in(bytes);
+    return zpp::bits::success(in(output));
+  }
+
+  std::vector<std::byte> bytes;
+};
+
+} // namespace benchmark
+
+} // namespace alpaca
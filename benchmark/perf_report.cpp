@@ -0,0 +1,128 @@
+#include "perf_report.h"
+#include <cerrno>
+#include <cstdint>
+#include <cstdio>
+#include <cstring>
+#include <linux/perf_event.h>
+#include <sys/ioctl.h>
+#include <sys/syscall.h>
+#include <unistd.h>
+
+namespace {
+
+struct event {
+  const char *name;
+  uint32_t type;
+  uint64_t config;
+};
+
+constexpr uint64_t cache_read_miss(uint64_t cache) {
+  return cache | (PERF_COUNT_HW_CACHE_OP_READ << 8) |
+         (PERF_COUNT_HW_CACHE_RESULT_MISS << 16);
+}
+
+constexpr event events[alpaca::benchmark::perf_report::num_events] = {
+    {"Cycles", PERF_TYPE_HARDWARE, PERF_COUNT_HW_CPU_CYCLES},
+    {"Instructions", PERF_TYPE_HARDWARE, PERF_COUNT_HW_INSTRUCTIONS},
+    {"BranchMisses", PERF_TYPE_HARDWARE, PERF_COUNT_HW_BRANCH_MISSES},
+    {"L1DMisses", PERF_TYPE_HW_CACHE,
+     cache_read_miss(PERF_COUNT_HW_CACHE_L1D)},
+    {"LLCMisses", PERF_TYPE_HW_CACHE, cache_read_miss(PERF_COUNT_HW_CACHE_LL)},
+};
+
+int open_event(const event &e) {
+  perf_event_attr attr;
+  std::memset(&attr, 0, sizeof(attr));
+  attr.size = sizeof(attr);
+  attr.type = e.type;
+  attr.config = e.config;
+  attr.disabled = 1;
+  attr.inherit = 1;
+  attr.exclude_kernel = 1;
+  attr.exclude_hv = 1;
+  // scaled by enabled / running time when the PMU is multiplexed
+  attr.read_format =
+      PERF_FORMAT_TOTAL_TIME_ENABLED | PERF_FORMAT_TOTAL_TIME_RUNNING;
+  return static_cast<int>(syscall(SYS_perf_event_open, &attr, 0, -1, -1,
+                                  PERF_FLAG_FD_CLOEXEC));
+}
+
+// warns once per program, not once per benchmark run
+void warn_unavailable(int error) {
+  static const bool warned = [error] {
+    std::fprintf(stderr,
+                 "alpaca::benchmark::perf_report: perf_event_open failed "
+                 "(%s), no hardware counters are reported\n",
+                 std::strerror(error));
+    return true;
+  }();
+  (void)warned;
+}
+
+} // namespace
+
+namespace alpaca {
+
+namespace benchmark {
+
+perf_report::perf_report() {
+  int error = 0;
+  bool any = false;
+  for (int i = 0; i < num_events; ++i) {
+    fds_[i] = open_event(events[i]);
+    if (fds_[i] < 0) {
+      error = errno;
+    } else {
+      any = true;
+    }
+  }
+  if (!any) {
+    warn_unavailable(error);
+    return;
+  }
+  for (int fd : fds_) {
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_RESET, 0);
+      ioctl(fd, PERF_EVENT_IOC_ENABLE, 0);
+    }
+  }
+}
+
+perf_report::~perf_report() {
+  for (int fd : fds_) {
+    if (fd >= 0) {
+      close(fd);
+    }
+  }
+}
+
+void perf_report::report(::benchmark::State &state) const {
+  for (int fd : fds_) {
+    if (fd >= 0) {
+      ioctl(fd, PERF_EVENT_IOC_DISABLE, 0);
+    }
+  }
+
+  double values[num_events] = {};
+  for (int i = 0; i < num_events; ++i) {
+    // value, time enabled, time running
+    uint64_t data[3] = {};
+    if (fds_[i] < 0 || read(fds_[i], data, sizeof(data)) != sizeof(data) ||
+        data[2] == 0) {
+      continue;
+    }
+    values[i] = static_cast<double>(data[0]) * static_cast<double>(data[1]) /
+                static_cast<double>(data[2]);
+    state.counters[events[i].name] = ::benchmark::Counter(
+        values[i], ::benchmark::Counter::kAvgIterations);
+  }
+
+  // cycles and instructions
+  if (values[0] > 0 && values[1] > 0) {
+    state.counters["IPC"] = values[1] / values[0];
+  }
+}
+
+} // namespace benchmark
+
+} // namespace alpaca
@@ -0,0 +1,48 @@
+#pragma once
+#include <benchmark/benchmark.h>
+
+namespace alpaca {
+
+namespace benchmark {
+
+// Reports the hardware performance counters of a benchmark loop, read with
+// perf_event_open, when the benchmarks are configured with
+// -DALPACA_BENCHMARK_PERF_COUNTERS=ON (Linux only)
+//
+//   alpaca::benchmark::perf_report perf;
+//   for (auto _ : state) {
+//     ...
+//   }
+//   perf.report(state);
+//
+// Cycles, Instructions, BranchMisses, L1DMisses and LLCMisses are per
+// iteration, counted in user space for the calling thread and the threads it
+// starts in the loop. Counters that the CPU or kernel does not provide, e.g.,
+// in a VM or with kernel.perf_event_paranoid > 2, are left out. Without the
+// option, perf_report does nothing
+#ifdef ALPACA_BENCHMARK_PERF_COUNTERS
+class perf_report {
+public:
+  perf_report();
+  ~perf_report();
+
+  perf_report(const perf_report &) = delete;
+  perf_report &operator=(const perf_report &) = delete;
+
+  void report(::benchmark::State &state) const;
+
+  static constexpr int num_events = 5;
+
+private:
+  int fds_[num_events];
+};
+#else
+class perf_report {
+public:
+  void report(::benchmark::State &) const {}
+};
+#endif
+
+} // namespace benchmark
+
+} // namespace alpaca
@@ -1,11 +1,15 @@
 #pragma once
 #include <alpaca/detail/aggregate_arity.h>
+#include <alpaca/detail/byte_span.h>
 #include <alpaca/detail/crc32.h>
+#include <alpaca/detail/decode_limits.h>
 #include <alpaca/detail/endian.h>
+#include <alpaca/detail/fixed_layout.h>
 #include <alpaca/detail/from_bytes.h>
 #include <alpaca/detail/is_specialization.h>
 #include <alpaca/detail/options.h>
 #include <alpaca/detail/print_bytes.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/struct_nth_field.h>
 #include <alpaca/detail/to_bytes.h>
 #include <alpaca/detail/type_info.h>
@@ -41,6 +45,9 @@ namespace alpaca {
 
 namespace detail {
 
+// measures a field for alpaca::profile, defined in detail/profile.h
+template <std::size_t I, typename F> class profile_field_guard;
+
 template <typename T, std::size_t N, std::size_t I>
 void type_info_helper(
     std::vector<uint8_t> &typeids,
@@ -132,12 +139,22 @@ void to_bytes_router(const T &input, Container &bytes,
 template <options O, typename T, std::size_t N, typename Container,
           std::size_t I>
 void serialize_helper(const T &s, Container &bytes, std::size_t &byte_index) {
-  if constexpr (I < N) {
+  if constexpr (I == 0 && N > 0 && fixed_serialized_size<O, T, N>() > 0) {
+    // every field has a fixed size - write the whole struct at once
+    to_bytes_fixed<O, T, N>(s, bytes, byte_index);
+  } else if constexpr (I < N) {
     const auto &ref = s;
     decltype(auto) field = detail::get<I, decltype(ref), N>(ref);
 
-    // serialize field
-    detail::to_bytes_router<O>(field, bytes, byte_index);
+    if constexpr (detail::profile_fields<O>()) {
+      // called through alpaca::profile - measure the field
+      detail::profile_field_guard<I, std::decay_t<decltype(field)>> profiled(
+          byte_index);
+      detail::to_bytes_router<O>(field, bytes, byte_index);
+    } else {
+      // serialize field
+      detail::to_bytes_router<O>(field, bytes, byte_index);
+    }
 
     // go to next field
     serialize_helper<O, T, N, Container, I + 1>(s, bytes, byte_index);
@@ -213,6 +230,9 @@ serialize(const T &s, Container &bytes, std::size_t &byte_index) {
                 "options::with_version is not supported when writing to file");
   static_assert(!detail::with_checksum<O>(),
                 "options::with_checksum is not supported when writing to file");
+  static_assert(
+      !detail::with_chunk_index<O>(),
+      "options::with_chunk_index is not supported when writing to file");
   detail::serialize_helper<O, T, N, Container, 0>(s, bytes, byte_index);
   return byte_index;
 }
@@ -292,9 +312,17 @@ void deserialize_helper(T &s, Container &bytes, std::size_t &byte_index,
   if constexpr (I < N) {
     decltype(auto) field = detail::get<I, T, N>(s);
 
-    // load current field
-    detail::from_bytes_router<O>(field, bytes, byte_index, end_index,
-                                 error_code);
+    if constexpr (detail::profile_fields<O>()) {
+      // called through alpaca::profile - measure the field
+      detail::profile_field_guard<I, std::decay_t<decltype(field)>> profiled(
+          byte_index);
+      detail::from_bytes_router<O>(field, bytes, byte_index, end_index,
+                                   error_code);
+    } else {
+      // load current field
+      detail::from_bytes_router<O>(field, bytes, byte_index, end_index,
+                                   error_code);
+    }
 
     if (error_code) {
       // stop here
@@ -307,6 +335,107 @@ void deserialize_helper(T &s, Container &bytes, std::size_t &byte_index,
   }
 }
 
+/// N -> number of fields in struct
+/// I -> field to start from
+template <options O, typename T, std::size_t N, typename Container,
+          std::size_t I>
+bool skip_helper(Container &bytes, std::size_t &byte_index,
+                 std::size_t &end_index, std::error_code &error_code) {
+  if constexpr (I < N) {
+    // skip current field
+    if (!detail::skip<O, nth_field_type_t<T, N, I>>(bytes, byte_index,
+                                                     end_index, error_code)) {
+      // stop here
+      return false;
+    }
+
+    // go to next field
+    return skip_helper<O, T, N, Container, I + 1>(bytes, byte_index,
+                                                  end_index, error_code);
+  } else {
+    return true;
+  }
+}
+
+// version for nested struct/class types
+template <options O, typename T, typename Container>
+typename std::enable_if<std::is_aggregate_v<T> && !is_array_type<T>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &byte_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  return skip_helper<O, T, detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+                     Container, 0>(bytes, byte_index, end_index, error_code);
+}
+
+// hash of the type_info of T (with N fields)
+// computed on first use, so later checks do not allocate
+template <typename T, std::size_t N> uint32_t type_hash() {
+  static const uint32_t hash = [] {
+    std::vector<uint8_t> typeids;
+    std::unordered_map<std::string_view, std::size_t> struct_visitor_map;
+    detail::type_info<T, N>(typeids, struct_visitor_map);
+    return crc32_fast(typeids.data(), typeids.size());
+  }();
+  return hash;
+}
+
+// check the type hash at the start of the input, if requested
+template <options O, typename T, std::size_t N, typename Container>
+bool check_version(Container &bytes, std::size_t &byte_index,
+                   std::size_t &end_index, std::error_code &error_code) {
+  if constexpr (N > 0 && detail::with_version<O>()) {
+    uint32_t computed_version = type_hash<T, N>();
+
+    // there should be at least 4 bytes in input
+    if (end_index < byte_index || end_index - byte_index < 4) {
+      error_code = std::make_error_code(std::errc::invalid_argument);
+      return false;
+    }
+
+    uint32_t version = 0;
+    detail::from_bytes_crc32<O>(version, bytes, byte_index, end_index,
+                                error_code);
+    if (version != computed_version) {
+      error_code = std::make_error_code(std::errc::invalid_argument);
+      return false;
+    }
+  }
+  return true;
+}
+
+// check the trailing checksum, if requested, and exclude it from the input
+template <options O, typename Container>
+bool check_checksum(Container &bytes, std::size_t &end_index,
+                    std::error_code &error_code) {
+  if constexpr (detail::with_checksum<O>()) {
+    // bytes must be at least 4 bytes long
+    if (end_index < 4) {
+      error_code = std::make_error_code(std::errc::invalid_argument);
+      return false;
+    }
+
+    uint32_t trailing_crc = 0;
+    std::size_t index = end_index - 4;
+    detail::from_bytes_crc32<O>(trailing_crc, bytes, index, end_index,
+                                error_code); // last 4 bytes
+
+    uint32_t computed_crc = 0;
+    if constexpr (std::is_array_v<Container>) {
+      computed_crc = crc32_fast(bytes, end_index - 4);
+    } else {
+      computed_crc = crc32_fast(bytes.data(), end_index - 4);
+    }
+
+    if (trailing_crc != computed_crc) {
+      error_code = std::make_error_code(std::errc::bad_message);
+      return false;
+    }
+
+    end_index -= 4;
+  }
+  return true;
+}
+
 } // namespace detail
 
 template <typename T,
@@ -443,6 +572,9 @@ deserialize(T &s, Container &bytes, std::size_t &byte_index,
   static_assert(
       !detail::with_checksum<O>(),
       "options::with_checksum is not supported when reading from file");
+  static_assert(
+      !detail::with_chunk_index<O>(),
+      "options::with_chunk_index is not supported when reading from file");
   detail::deserialize_helper<O, T, N, Container, 0>(s, bytes, byte_index,
                                                     end_index, error_code);
 }
@@ -556,4 +688,273 @@ T deserialize(Container &bytes, std::size_t size, std::error_code &error_code) {
   return object;
 }
 
+// Deserialize with limits on the memory and nesting depth that the input can
+// make the decoder use - for input that is not trusted
+template <options O, typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container>
+T deserialize(Container &bytes, std::size_t size, const decode_limits &limits,
+              std::error_code &error_code) {
+  detail::decode_context_scope scope(limits);
+  return deserialize<O, T, N, Container>(bytes, size, error_code);
+}
+
+template <options O, typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container>
+T deserialize(Container &bytes, const decode_limits &limits,
+              std::error_code &error_code) {
+  detail::decode_context_scope scope(limits);
+  return deserialize<O, T, N, Container>(bytes, error_code);
+}
+
+template <typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container>
+T deserialize(Container &bytes, std::size_t size, const decode_limits &limits,
+              std::error_code &error_code) {
+  return deserialize<options::none, T, N, Container>(bytes, size, limits,
+                                                     error_code);
+}
+
+template <typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container>
+T deserialize(Container &bytes, const decode_limits &limits,
+              std::error_code &error_code) {
+  return deserialize<options::none, T, N, Container>(bytes, limits,
+                                                     error_code);
+}
+
+// Skip a serialized T (with N fields) in bytes, starting at byte_index
+// Nothing is constructed - only lengths, flags and variant indices are read
+// On success, byte_index points past the skipped value
+template <options O, typename T,
+          std::size_t N = detail::arity_or_zero<T>(), typename Container>
+bool skip(Container &bytes, std::size_t &byte_index, std::size_t &end_index,
+          std::error_code &error_code) {
+  if constexpr (std::is_aggregate_v<T> && !detail::is_array_type<T>::value) {
+    return detail::skip_helper<O, T, N, Container, 0>(bytes, byte_index,
+                                                      end_index, error_code);
+  } else {
+    return detail::skip<O, T>(bytes, byte_index, end_index, error_code);
+  }
+}
+
+template <typename T, std::size_t N = detail::arity_or_zero<T>(),
+          typename Container>
+bool skip(Container &bytes, std::size_t &byte_index, std::size_t &end_index,
+          std::error_code &error_code) {
+  return skip<options::none, T, N, Container>(bytes, byte_index, end_index,
+                                              error_code);
+}
+
+// Check that `size` bytes in a Container hold a well-formed T (with N fields)
+// using options O, without constructing it or allocating memory
+// Returns the number of bytes occupied by the message
+template <options O, typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container>
+std::size_t validate(Container &bytes, std::size_t size,
+                     std::error_code &error_code) {
+  if (size == 0) {
+    error_code = std::make_error_code(std::errc::message_size);
+    return 0;
+  }
+
+  std::size_t byte_index = 0;
+  std::size_t end_index = size;
+  if (!detail::check_version<O, T, N>(bytes, byte_index, end_index,
+                                      error_code) ||
+      !detail::check_checksum<O>(bytes, end_index, error_code) ||
+      !detail::skip_helper<O, T, N, Container, 0>(bytes, byte_index,
+                                                  end_index, error_code)) {
+    return 0;
+  }
+
+  if constexpr (detail::with_checksum<O>()) {
+    // the trailing checksum closes the message
+    return size;
+  } else {
+    return byte_index;
+  }
+}
+
+template <options O, typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container>
+std::size_t validate(Container &bytes, std::error_code &error_code) {
+  return validate<O, T, N, Container>(bytes, bytes.size(), error_code);
+}
+
+template <typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container>
+std::size_t validate(Container &bytes, std::size_t size,
+                     std::error_code &error_code) {
+  return validate<options::none, T, N, Container>(bytes, size, error_code);
+}
+
+template <typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container>
+std::size_t validate(Container &bytes, std::error_code &error_code) {
+  return validate<options::none, T, N, Container>(bytes, bytes.size(),
+                                                  error_code);
+}
+
+// A read-only view over a serialized T that decodes a field only when it is
+// accessed. Fields in front of it are stepped over with the skip walker, and
+// their offsets are remembered so later accesses do not walk them again.
+//
+// The view does not own the bytes - the container must outlive it.
+template <typename T, options O = options::none,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container = std::vector<uint8_t>>
+class lazy {
+public:
+  static constexpr std::size_t num_fields = N;
+
+  template <std::size_t I>
+  using field_type = detail::nth_field_type_t<T, num_fields, I>;
+
+  lazy(const Container &bytes, std::error_code &error_code)
+      : lazy(bytes, bytes.size(), error_code) {}
+
+  lazy(const Container &bytes, std::size_t size, std::error_code &error_code)
+      : bytes_(bytes), end_index_(size) {
+    std::size_t byte_index = 0;
+    if (size == 0) {
+      error_code = std::make_error_code(std::errc::message_size);
+    } else if (detail::check_version<O, T, num_fields>(bytes_, byte_index,
+                                                       end_index_,
+                                                       error_code)) {
+      detail::check_checksum<O>(bytes_, end_index_, error_code);
+    }
+    offsets_[0] = byte_index;
+    status_ = error_code;
+  }
+
+  // the view would outlive a temporary container
+  lazy(const Container &&, std::error_code &) = delete;
+  lazy(const Container &&, std::size_t, std::error_code &) = delete;
+
+  // decode the I-th field
+  template <std::size_t I>
+  field_type<I> get(std::error_code &error_code) const {
+    static_assert(I < num_fields, "field index out of range");
+
+    field_type<I> value{};
+    if (status_) {
+      error_code = status_;
+      return value;
+    }
+
+    if (!seek<I>(error_code)) {
+      return value;
+    }
+
+    std::size_t byte_index = offsets_[I];
+    std::size_t end_index = end_index_;
+    detail::from_bytes_router<O>(value, bytes_, byte_index, end_index,
+                                 error_code);
+
+    if (!error_code && num_offsets_ == I + 1) {
+      // the next field starts where this one ended
+      offsets_[I + 1] = byte_index;
+      num_offsets_ = I + 2;
+    }
+    return value;
+  }
+
+private:
+  // find where the K-th field starts, skipping fields as needed
+  template <std::size_t K> bool seek(std::error_code &error_code) const {
+    if constexpr (K > 0) {
+      if (K < num_offsets_) {
+        return true;
+      }
+      if (!seek<K - 1>(error_code)) {
+        return false;
+      }
+
+      std::size_t byte_index = offsets_[K - 1];
+      std::size_t end_index = end_index_;
+      if (!detail::skip<O, field_type<K - 1>>(bytes_, byte_index, end_index,
+                                              error_code)) {
+        return false;
+      }
+
+      offsets_[K] = byte_index;
+      num_offsets_ = K + 1;
+    }
+    return true;
+  }
+
+  const Container &bytes_;
+  std::size_t end_index_;
+  std::error_code status_;
+
+  // offsets_[i] is the start of field i, valid for i < num_offsets_
+  mutable std::array<std::size_t, num_fields + 1> offsets_{};
+  mutable std::size_t num_offsets_{1};
+};
+
+// The encoder and decoder of T (with N fields) for one Container and set of
+// options, as a class that can be instantiated explicitly.
+//
+// The member functions are defined out of class, so that
+//
+//   ALPACA_DECLARE_CODEC(T);  // in a header
+//   ALPACA_DEFINE_CODEC(T);   // in exactly one .cpp
+//
+// instantiates serialize_helper/deserialize_helper for T once, in that .cpp,
+// and every other translation unit only calls into it.
+template <typename T, options O = options::none,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container = std::vector<uint8_t>>
+class codec {
+public:
+  static std::size_t serialize(const T &s, Container &bytes);
+
+  static T deserialize(Container &bytes, std::error_code &error_code);
+
+  static T deserialize(Container &bytes, std::size_t size,
+                       std::error_code &error_code);
+
+  static T deserialize(Container &bytes, const decode_limits &limits,
+                       std::error_code &error_code);
+};
+
+template <typename T, options O, std::size_t N, typename Container>
+std::size_t codec<T, O, N, Container>::serialize(const T &s,
+                                                 Container &bytes) {
+  return alpaca::serialize<O, T, N, Container>(s, bytes);
+}
+
+template <typename T, options O, std::size_t N, typename Container>
+T codec<T, O, N, Container>::deserialize(Container &bytes,
+                                         std::error_code &error_code) {
+  return alpaca::deserialize<O, T, N, Container>(bytes, error_code);
+}
+
+template <typename T, options O, std::size_t N, typename Container>
+T codec<T, O, N, Container>::deserialize(Container &bytes, std::size_t size,
+                                         std::error_code &error_code) {
+  return alpaca::deserialize<O, T, N, Container>(bytes, size, error_code);
+}
+
+template <typename T, options O, std::size_t N, typename Container>
+T codec<T, O, N, Container>::deserialize(Container &bytes,
+                                         const decode_limits &limits,
+                                         std::error_code &error_code) {
+  return alpaca::deserialize<O, T, N, Container>(bytes, limits, error_code);
+}
+
 } // namespace alpaca
+
+// Explicit instantiation of alpaca::codec<...>, at global scope
+// e.g., ALPACA_DECLARE_CODEC(Player, alpaca::options::with_checksum);
+#define ALPACA_DECLARE_CODEC(...)                                              \
+  extern template class alpaca::codec<__VA_ARGS__>
+#define ALPACA_DEFINE_CODEC(...) template class alpaca::codec<__VA_ARGS__>
@@ -0,0 +1,484 @@
+#pragma once
+#include <alpaca/alpaca.h>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <algorithm>
+#include <cerrno>
+#include <cstdio>
+#include <condition_variable>
+#include <deque>
+#include <future>
+#include <mutex>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+#if defined(__linux__) && defined(__has_include)
+#if __has_include(<linux/io_uring.h>)
+#define ALPACA_HAS_IO_URING
+#include <linux/io_uring.h>
+#include <sys/mman.h>
+#include <sys/syscall.h>
+#endif
+#endif
+
+namespace alpaca {
+
+namespace detail {
+
+#ifdef ALPACA_HAS_IO_URING
+// Minimal io_uring submission and completion queues, without liburing
+// Submissions must be serialized by the caller; completions are consumed by
+// a single thread
+class io_uring_queue {
+public:
+  io_uring_queue() = default;
+
+  ~io_uring_queue() {
+    if (sqes_ != nullptr) {
+      ::munmap(sqes_, sqes_size_);
+    }
+    if (cq_ring_ != nullptr && cq_ring_ != sq_ring_) {
+      ::munmap(cq_ring_, cq_ring_size_);
+    }
+    if (sq_ring_ != nullptr) {
+      ::munmap(sq_ring_, sq_ring_size_);
+    }
+    if (fd_ >= 0) {
+      ::close(fd_);
+    }
+  }
+
+  io_uring_queue(const io_uring_queue &) = delete;
+  io_uring_queue &operator=(const io_uring_queue &) = delete;
+
+  // false if io_uring is not available, e.g., blocked by a seccomp filter
+  bool init(unsigned entries) {
+    io_uring_params params{};
+    fd_ = static_cast<int>(::syscall(__NR_io_uring_setup, entries, &params));
+    if (fd_ < 0) {
+      return false;
+    }
+
+    sq_ring_size_ = params.sq_off.array + params.sq_entries * sizeof(unsigned);
+    cq_ring_size_ =
+        params.cq_off.cqes + params.cq_entries * sizeof(io_uring_cqe);
+    const bool single_mmap = params.features & IORING_FEAT_SINGLE_MMAP;
+    if (single_mmap) {
+      sq_ring_size_ = cq_ring_size_ = std::max(sq_ring_size_, cq_ring_size_);
+    }
+
+    sq_ring_ = map(sq_ring_size_, IORING_OFF_SQ_RING);
+    cq_ring_ = single_mmap ? sq_ring_ : map(cq_ring_size_, IORING_OFF_CQ_RING);
+    sqes_size_ = params.sq_entries * sizeof(io_uring_sqe);
+    sqes_ = static_cast<io_uring_sqe *>(map(sqes_size_, IORING_OFF_SQES));
+    if (sq_ring_ == nullptr || cq_ring_ == nullptr || sqes_ == nullptr) {
+      return false;
+    }
+
+    auto *sq = static_cast<uint8_t *>(sq_ring_);
+    sq_head_ = reinterpret_cast<unsigned *>(sq + params.sq_off.head);
+    sq_tail_ = reinterpret_cast<unsigned *>(sq + params.sq_off.tail);
+    sq_mask_ = *reinterpret_cast<unsigned *>(sq + params.sq_off.ring_mask);
+    sq_entries_ = params.sq_entries;
+    sq_array_ = reinterpret_cast<unsigned *>(sq + params.sq_off.array);
+
+    auto *cq = static_cast<uint8_t *>(cq_ring_);
+    cq_head_ = reinterpret_cast<unsigned *>(cq + params.cq_off.head);
+    cq_tail_ = reinterpret_cast<unsigned *>(cq + params.cq_off.tail);
+    cq_mask_ = *reinterpret_cast<unsigned *>(cq + params.cq_off.ring_mask);
+    cqes_ = reinterpret_cast<io_uring_cqe *>(cq + params.cq_off.cqes);
+    return true;
+  }
+
+  // queue a write of data[0, size) to fd at `offset`
+  bool submit_write(int fd, const void *data, unsigned size, uint64_t offset,
+                    uint64_t user_data) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_WRITE;
+    sqe.fd = fd;
+    sqe.addr = reinterpret_cast<uint64_t>(data);
+    sqe.len = size;
+    sqe.off = offset;
+    sqe.user_data = user_data;
+    return submit(sqe);
+  }
+
+  // queue a no-op, e.g., to wake the thread waiting for completions
+  bool submit_nop(uint64_t user_data) {
+    io_uring_sqe sqe{};
+    sqe.opcode = IORING_OP_NOP;
+    sqe.user_data = user_data;
+    return submit(sqe);
+  }
+
+  // wait for the next completion
+  // `result` is the number of bytes written or -errno
+  void wait(uint64_t &user_data, int &result) {
+    while (true) {
+      const auto head = *cq_head_;
+      if (head != __atomic_load_n(cq_tail_, __ATOMIC_ACQUIRE)) {
+        const auto &cqe = cqes_[head & cq_mask_];
+        user_data = cqe.user_data;
+        result = cqe.res;
+        __atomic_store_n(cq_head_, head + 1, __ATOMIC_RELEASE);
+        return;
+      }
+      ::syscall(__NR_io_uring_enter, fd_, 0, 1, IORING_ENTER_GETEVENTS,
+                nullptr, 0);
+    }
+  }
+
+private:
+  void *map(std::size_t size, off_t offset) {
+    void *mapping = ::mmap(nullptr, size, PROT_READ | PROT_WRITE,
+                           MAP_SHARED | MAP_POPULATE, fd_, offset);
+    return mapping == MAP_FAILED ? nullptr : mapping;
+  }
+
+  bool submit(const io_uring_sqe &sqe) {
+    const auto tail = *sq_tail_;
+    if (tail - __atomic_load_n(sq_head_, __ATOMIC_ACQUIRE) == sq_entries_) {
+      return false;
+    }
+    const auto index = tail & sq_mask_;
+    sqes_[index] = sqe;
+    sq_array_[index] = index;
+    __atomic_store_n(sq_tail_, tail + 1, __ATOMIC_RELEASE);
+
+    long submitted = 0;
+    do {
+      submitted = ::syscall(__NR_io_uring_enter, fd_, 1, 0, 0, nullptr, 0);
+    } while (submitted < 0 && errno == EINTR);
+    return submitted == 1;
+  }
+
+  int fd_{-1};
+  void *sq_ring_{nullptr};
+  void *cq_ring_{nullptr};
+  std::size_t sq_ring_size_{0};
+  std::size_t cq_ring_size_{0};
+  io_uring_sqe *sqes_{nullptr};
+  std::size_t sqes_size_{0};
+
+  unsigned *sq_head_{nullptr};
+  unsigned *sq_tail_{nullptr};
+  unsigned sq_mask_{0};
+  unsigned sq_entries_{0};
+  unsigned *sq_array_{nullptr};
+
+  unsigned *cq_head_{nullptr};
+  unsigned *cq_tail_{nullptr};
+  unsigned cq_mask_{0};
+  io_uring_cqe *cqes_{nullptr};
+};
+#endif
+
+// flush the directory holding `path`, so that a rename into it is on disk
+inline std::error_code sync_parent_directory(const std::string &path) {
+  const auto slash = path.find_last_of('/');
+  const std::string directory =
+      slash == std::string::npos ? "." : path.substr(0, slash == 0 ? 1 : slash);
+  const int fd = ::open(directory.c_str(), O_RDONLY | O_CLOEXEC);
+  if (fd < 0) {
+    return std::error_code(errno, std::generic_category());
+  }
+  std::error_code error_code;
+  // EINVAL: the file system does not sync directories
+  if (::fsync(fd) != 0 && errno != EINVAL) {
+    error_code = std::error_code(errno, std::generic_category());
+  }
+  ::close(fd);
+  return error_code;
+}
+
+} // namespace detail
+
+// Saves snapshots to files without blocking the caller on disk I/O
+//
+// save() serializes into one of two buffers on the calling thread, starts
+// writing the buffer to the file and returns; the caller can serialize the
+// next snapshot into the other buffer while the write is in flight. The
+// future is ready once the file is written and closed.
+//
+// The snapshot is written to a temporary file next to `path`, synced, and
+// then renamed over `path`, so a crash during a save leaves the previous
+// file intact
+//
+// Writes go through io_uring on Linux, and through pwrite on a background
+// thread where io_uring is not available
+class async_file_writer {
+public:
+  // `use_io_uring` = false forces the pwrite fallback
+  explicit async_file_writer(bool use_io_uring = true) {
+#ifdef ALPACA_HAS_IO_URING
+    uses_io_uring_ = use_io_uring && ring_.init(8);
+#else
+    (void)use_io_uring;
+#endif
+    thread_ = std::thread([this] {
+#ifdef ALPACA_HAS_IO_URING
+      if (uses_io_uring_) {
+        complete_io_uring();
+        return;
+      }
+#endif
+      complete_pwrite();
+    });
+  }
+
+  // waits for the writes in flight
+  ~async_file_writer() {
+    wait();
+#ifdef ALPACA_HAS_IO_URING
+    if (uses_io_uring_) {
+      std::lock_guard<std::mutex> lock(submit_mutex_);
+      ring_.submit_nop(0);
+    }
+#endif
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    queue_changed_.notify_all();
+    thread_.join();
+  }
+
+  async_file_writer(const async_file_writer &) = delete;
+  async_file_writer &operator=(const async_file_writer &) = delete;
+
+  // true if writes are submitted through io_uring
+  bool uses_io_uring() const noexcept { return uses_io_uring_; }
+
+  // Serialize `s` (with N fields) and write it to the file at `path`,
+  // atomically replacing the file
+  // Blocks only while both buffers are still being written
+  template <options O, typename T,
+            std::size_t N =
+                detail::aggregate_arity<std::remove_cv_t<T>>::size()>
+  std::future<std::error_code> save(const T &s, const std::string &path) {
+    auto &slot = acquire();
+    slot.bytes.clear();
+    serialize<O, T, N>(s, slot.bytes);
+    return start(slot, path);
+  }
+
+  template <typename T,
+            std::size_t N =
+                detail::aggregate_arity<std::remove_cv_t<T>>::size()>
+  std::future<std::error_code> save(const T &s, const std::string &path) {
+    return save<options::none, T, N>(s, path);
+  }
+
+  // Wait for all writes in flight
+  void wait() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    slot_released_.wait(lock, [this] {
+      return !slots_[0].busy && !slots_[1].busy;
+    });
+  }
+
+private:
+  // a buffer and the write of it that is in flight
+  struct buffer_slot {
+    std::vector<uint8_t> bytes;
+    bool busy{false};
+    std::string path;
+    std::string temp_path;
+    int fd{-1};
+    std::size_t written{0};
+    std::promise<std::error_code> promise;
+  };
+
+  buffer_slot &acquire() {
+    std::unique_lock<std::mutex> lock(mutex_);
+    buffer_slot *free = nullptr;
+    slot_released_.wait(lock, [&] {
+      for (auto &candidate : slots_) {
+        if (!candidate.busy) {
+          free = &candidate;
+          return true;
+        }
+      }
+      return false;
+    });
+    free->busy = true;
+    return *free;
+  }
+
+  std::future<std::error_code> start(buffer_slot &slot,
+                                     const std::string &path) {
+    slot.promise = std::promise<std::error_code>();
+    auto future = slot.promise.get_future();
+
+    // one temporary file per buffer, so that two saves to the same path in
+    // flight do not write to the same file
+    slot.path = path;
+    slot.temp_path = path + ".tmp" + std::to_string(&slot - slots_);
+    slot.fd = ::open(slot.temp_path.c_str(),
+                     O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0644);
+    if (slot.fd < 0) {
+      complete(slot, std::error_code(errno, std::generic_category()));
+      return future;
+    }
+
+    slot.written = 0;
+    submit(slot);
+    return future;
+  }
+
+  // write the rest of the slot, or complete it if there is nothing left
+  void submit(buffer_slot &slot) {
+    if (slot.written == slot.bytes.size()) {
+      complete(slot, {});
+      return;
+    }
+
+#ifdef ALPACA_HAS_IO_URING
+    if (uses_io_uring_) {
+      // one write is at most 1 GB, the rest is submitted when it completes
+      const auto size = static_cast<unsigned>(
+          std::min<std::size_t>(slot.bytes.size() - slot.written, 1u << 30));
+      bool submitted = false;
+      {
+        std::lock_guard<std::mutex> lock(submit_mutex_);
+        submitted = ring_.submit_write(
+            slot.fd, slot.bytes.data() + slot.written, size, slot.written,
+            reinterpret_cast<uint64_t>(&slot));
+      }
+      if (!submitted) {
+        complete(slot, std::make_error_code(std::errc::io_error));
+      }
+      return;
+    }
+#endif
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      queue_.push_back(&slot);
+    }
+    queue_changed_.notify_one();
+  }
+
+  // sync and close the file, move it over the destination and release the
+  // slot
+  void complete(buffer_slot &slot, std::error_code error_code) {
+    if (slot.fd >= 0) {
+      if (!error_code && ::fsync(slot.fd) != 0) {
+        error_code = std::error_code(errno, std::generic_category());
+      }
+      if (::close(slot.fd) != 0 && !error_code) {
+        error_code = std::error_code(errno, std::generic_category());
+      }
+      slot.fd = -1;
+
+      if (!error_code) {
+        if (::rename(slot.temp_path.c_str(), slot.path.c_str()) == 0) {
+          error_code = detail::sync_parent_directory(slot.path);
+        } else {
+          error_code = std::error_code(errno, std::generic_category());
+          ::unlink(slot.temp_path.c_str());
+        }
+      } else {
+        // the previous file at the destination is left untouched
+        ::unlink(slot.temp_path.c_str());
+      }
+    }
+
+    // release the slot before the future is ready, so that the caller can
+    // save again as soon as it sees the result
+    auto promise = std::move(slot.promise);
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      slot.busy = false;
+    }
+    slot_released_.notify_all();
+    promise.set_value(error_code);
+  }
+
+#ifdef ALPACA_HAS_IO_URING
+  void complete_io_uring() {
+    while (true) {
+      uint64_t user_data = 0;
+      int result = 0;
+      ring_.wait(user_data, result);
+      if (user_data == 0) {
+        return;
+      }
+
+      // pairs with the lock held while submitting, so that the slot is
+      // visible here also to tools that cannot see through the ring
+      { std::lock_guard<std::mutex> lock(submit_mutex_); }
+
+      auto &slot = *reinterpret_cast<buffer_slot *>(user_data);
+      if (result < 0) {
+        complete(slot, std::error_code(-result, std::generic_category()));
+      } else if (result == 0) {
+        complete(slot, std::make_error_code(std::errc::io_error));
+      } else {
+        // short writes are resubmitted
+        slot.written += static_cast<std::size_t>(result);
+        submit(slot);
+      }
+    }
+  }
+#endif
+
+  void complete_pwrite() {
+    while (true) {
+      buffer_slot *next = nullptr;
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        queue_changed_.wait(lock, [this] { return stop_ || !queue_.empty(); });
+        if (queue_.empty()) {
+          return;
+        }
+        next = queue_.front();
+        queue_.pop_front();
+      }
+
+      std::error_code error_code;
+      while (next->written < next->bytes.size()) {
+        const auto result = ::pwrite(
+            next->fd, next->bytes.data() + next->written,
+            next->bytes.size() - next->written,
+            static_cast<off_t>(next->written));
+        if (result < 0 && errno == EINTR) {
+          continue;
+        }
+        if (result <= 0) {
+          error_code = result < 0
+                           ? std::error_code(errno, std::generic_category())
+                           : std::make_error_code(std::errc::io_error);
+          break;
+        }
+        next->written += static_cast<std::size_t>(result);
+      }
+      complete(*next, error_code);
+    }
+  }
+
+  buffer_slot slots_[2];
+
+  std::mutex mutex_;
+  std::condition_variable slot_released_;
+  std::condition_variable queue_changed_;
+  std::deque<buffer_slot *> queue_;
+  bool stop_{false};
+
+  bool uses_io_uring_{false};
+#ifdef ALPACA_HAS_IO_URING
+  detail::io_uring_queue ring_;
+  std::mutex submit_mutex_;
+#endif
+
+  std::thread thread_;
+};
+
+} // namespace alpaca
+
+#endif
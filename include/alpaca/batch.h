@@ -0,0 +1,195 @@
+#pragma once
+#include <alpaca/alpaca.h>
+#include <alpaca/detail/thread_pool.h>
+#include <cstring>
+#include <iterator>
+#include <system_error>
+#include <vector>
+
+namespace alpaca {
+
+namespace detail {
+
+// number of frames decoded per task - enough to amortize claiming a task,
+// small enough to balance uneven frames across threads
+constexpr std::size_t batch_grain_size = 64;
+
+// encode the elements of `input` in chunks of vector_chunk_size, each into its
+// own buffer, then copy the buffers to their place in `bytes`
+template <options O, typename U, typename Executor>
+void to_bytes_vector_parallel(const std::vector<U> &input,
+                              std::vector<uint8_t> &bytes,
+                              std::size_t &byte_index, Executor &executor) {
+  to_bytes_router<O, std::size_t>(input.size(), bytes, byte_index);
+
+  const auto num_chunks = num_vector_chunks(input.size());
+  std::vector<std::vector<uint8_t>> chunks(num_chunks);
+
+  executor.execute(num_chunks, [&](std::size_t chunk) {
+    const auto first = chunk * vector_chunk_size;
+    const auto last = std::min(first + vector_chunk_size, input.size());
+    auto &buffer = chunks[chunk];
+    std::size_t index = 0;
+    for (std::size_t i = first; i < last; ++i) {
+      to_bytes_router<O>(input[i], buffer, index);
+    }
+  });
+
+  if constexpr (with_chunk_index<O>() && fixed_serialized_size<O, U>() == 0) {
+    // same chunks as the sequential encoding, so the sizes are known
+    for (const auto &chunk : chunks) {
+      write_chunk_size<O>(chunk.size(), bytes, byte_index);
+    }
+  }
+
+  // where each chunk goes in the output
+  std::vector<std::size_t> offsets(num_chunks);
+  std::size_t size = bytes.size();
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    offsets[chunk] = size;
+    size += chunks[chunk].size();
+  }
+  byte_index += size - bytes.size();
+  bytes.resize(size);
+
+  executor.execute(num_chunks, [&](std::size_t chunk) {
+    if (!chunks[chunk].empty()) {
+      std::memcpy(bytes.data() + offsets[chunk], chunks[chunk].data(),
+                  chunks[chunk].size());
+    }
+  });
+}
+
+// encode one field of the top-level struct, splitting vectors of at least two
+// chunks
+template <options O, typename U, typename Executor>
+void to_bytes_parallel(const U &input, std::vector<uint8_t> &bytes,
+                       std::size_t &byte_index, Executor &executor) {
+  if constexpr (is_specialization<U, std::vector>::value &&
+                !std::is_same_v<U, std::vector<bool>>) {
+    // vectors of fixed-layout elements are already a single copy
+    if constexpr (!has_serialized_layout<O, typename U::value_type>()) {
+      if (input.size() >= 2 * vector_chunk_size) {
+        to_bytes_vector_parallel<O>(input, bytes, byte_index, executor);
+        return;
+      }
+    }
+  }
+  to_bytes_router<O>(input, bytes, byte_index);
+}
+
+template <options O, typename T, std::size_t N, typename Executor,
+          std::size_t... I>
+void serialize_fields_parallel(const T &s, std::vector<uint8_t> &bytes,
+                               std::size_t &byte_index, Executor &executor,
+                               std::index_sequence<I...>) {
+  (to_bytes_parallel<O>(get<I, const T, N>(s), bytes, byte_index, executor),
+   ...);
+}
+
+} // namespace detail
+
+// Deserialize independent frames, each a serialized T (with N fields), on
+// `executor`
+//
+// frames[i] is anything that converts to byte_span, e.g.,
+// std::vector<uint8_t> or byte_span, and is decoded into output[i]
+// `output` must be a random access iterator, e.g., std::vector<T>::iterator
+// Returns the error code of every frame
+template <options O, typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Frames, typename OutputIterator, typename Executor>
+std::vector<std::error_code> deserialize_batch(const Frames &frames,
+                                               OutputIterator output,
+                                               Executor &executor) {
+  static_assert(
+      std::is_base_of_v<
+          std::random_access_iterator_tag,
+          typename std::iterator_traits<OutputIterator>::iterator_category>,
+      "output must be a random access iterator");
+
+  const std::size_t num_frames = std::size(frames);
+  std::vector<std::error_code> error_codes(num_frames);
+
+  const auto num_tasks = (num_frames + detail::batch_grain_size - 1) /
+                         detail::batch_grain_size;
+
+  executor.execute(num_tasks, [&](std::size_t task) {
+    const auto first = task * detail::batch_grain_size;
+    const auto last =
+        std::min(first + detail::batch_grain_size, num_frames);
+    for (std::size_t i = first; i < last; ++i) {
+      byte_span bytes(frames[i]);
+      output[i] = deserialize<O, T, N>(bytes, error_codes[i]);
+    }
+  });
+
+  return error_codes;
+}
+
+template <typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Frames, typename OutputIterator, typename Executor>
+std::vector<std::error_code> deserialize_batch(const Frames &frames,
+                                               OutputIterator output,
+                                               Executor &executor) {
+  return deserialize_batch<options::none, T, N>(frames, output, executor);
+}
+
+// Deserialize T (with N fields) like deserialize() does, decoding the chunks
+// of vectors written with options::with_chunk_index on `executor`
+// Without options::with_chunk_index this is the same as deserialize()
+template <options O, typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container, typename Executor>
+T deserialize_parallel(Container &bytes, Executor &executor,
+                       std::error_code &error_code) {
+  detail::decode_executor decode_executor(executor);
+  detail::decode_executor_scope scope(&decode_executor);
+  return deserialize<O, T, N>(bytes, error_code);
+}
+
+template <options O, typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container, typename Executor>
+T deserialize_parallel(Container &bytes, std::size_t size, Executor &executor,
+                       std::error_code &error_code) {
+  detail::decode_executor decode_executor(executor);
+  detail::decode_executor_scope scope(&decode_executor);
+  return deserialize<O, T, N>(bytes, size, error_code);
+}
+
+// Serialize T (with N fields) into bytes like serialize() does, encoding the
+// long std::vector fields of T in chunks on `executor`
+// The output is byte-for-byte the same as the output of serialize()
+template <options O, typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Executor>
+std::size_t serialize_parallel(const T &s, std::vector<uint8_t> &bytes,
+                               Executor &executor) {
+  std::size_t byte_index = 0;
+
+  if constexpr (N > 0 && detail::with_version<O>()) {
+    detail::to_bytes_crc32<O>(bytes, byte_index, detail::type_hash<T, N>());
+  }
+
+  detail::serialize_fields_parallel<O, T, N>(s, bytes, byte_index, executor,
+                                             std::make_index_sequence<N>{});
+
+  if constexpr (N > 0 && detail::with_checksum<O>()) {
+    uint32_t crc = crc32_fast(bytes.data(), byte_index);
+    detail::to_bytes_crc32<O>(bytes, byte_index, crc);
+  }
+
+  return byte_index;
+}
+
+template <typename T,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Executor>
+std::size_t serialize_parallel(const T &s, std::vector<uint8_t> &bytes,
+                               Executor &executor) {
+  return serialize_parallel<options::none, T, N>(s, bytes, executor);
+}
+
+} // namespace alpaca
@@ -0,0 +1,651 @@
+#pragma once
+#include <alpaca/alpaca.h>
+#include <alpaca/detail/mapped_region.h>
+#include <algorithm>
+#include <fstream>
+#include <limits>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace alpaca {
+
+// A block file is a record stream, see alpaca/record_stream.h, cut into
+// blocks that can be found and read on their own:
+//
+//   file header | block 0 | ... | block k-1 | index | trailer
+//
+//   file header  magic (4) | format version (4)
+//   block        header (32) | records
+//   header       magic (4) | record count (4) | records size (4) |
+//                records CRC32 (4) | first key (8) | header CRC32 (4) | 0 (4)
+//   record       key - first key (varint) | size (varint) | serialized T
+//   index        one entry per block:
+//                block offset (8) | first record (8) | first key (8) |
+//                record count (4) | 0 (4)
+//   trailer      index offset (8) | block count (8) | record count (8) |
+//                index CRC32 (4) | magic (4)
+//
+// Every record has a key, e.g., a timestamp, and keys are non-decreasing
+// across the file. All numbers outside the records are little-endian.
+//
+// The index and trailer are written when the file is closed. A file that
+// was not closed, e.g., after a crash, is recovered by walking the block
+// headers; only the last block is read in full, to check that it was
+// written completely
+
+namespace detail {
+
+constexpr uint32_t block_file_magic = 0x42504c41;  // "ALPB"
+constexpr uint32_t block_magic = 0x4b4c4241;       // "ABLK"
+constexpr uint32_t block_index_magic = 0x58444941; // "AIDX"
+constexpr uint32_t block_file_version = 1;
+
+constexpr std::size_t block_file_header_size = 8;
+constexpr std::size_t block_header_size = 32;
+constexpr std::size_t block_index_entry_size = 32;
+constexpr std::size_t block_file_trailer_size = 32;
+
+// records are cut into a new block once a block holds this many bytes
+constexpr std::size_t default_block_size = 1024 * 1024;
+
+// the records size of a block is stored in 32 bits
+constexpr std::size_t max_block_size = std::numeric_limits<uint32_t>::max();
+
+// largest record that fits in a block with its key and size varints
+constexpr std::size_t max_block_record_size = max_block_size - 2 * 10;
+
+inline void store_le(uint64_t value, std::size_t size, uint8_t *bytes) {
+  for (std::size_t i = 0; i < size; ++i) {
+    bytes[i] = static_cast<uint8_t>(value >> (8 * i));
+  }
+}
+
+inline uint64_t load_le(const uint8_t *bytes, std::size_t size) {
+  uint64_t value = 0;
+  for (std::size_t i = 0; i < size; ++i) {
+    value |= static_cast<uint64_t>(bytes[i]) << (8 * i);
+  }
+  return value;
+}
+
+struct block_entry {
+  uint64_t offset;
+  uint64_t first_record;
+  uint64_t first_key;
+  uint32_t record_count;
+
+  void store(uint8_t *bytes) const {
+    store_le(offset, 8, bytes);
+    store_le(first_record, 8, bytes + 8);
+    store_le(first_key, 8, bytes + 16);
+    store_le(record_count, 4, bytes + 24);
+    store_le(0, 4, bytes + 28);
+  }
+
+  static block_entry load(const uint8_t *bytes) {
+    return block_entry{load_le(bytes, 8), load_le(bytes + 8, 8),
+                       load_le(bytes + 16, 8),
+                       static_cast<uint32_t>(load_le(bytes + 24, 4))};
+  }
+};
+
+struct block_header {
+  uint32_t record_count;
+  uint32_t size;
+  uint32_t crc;
+  uint64_t first_key;
+
+  void store(uint8_t *bytes) const {
+    store_le(block_magic, 4, bytes);
+    store_le(record_count, 4, bytes + 4);
+    store_le(size, 4, bytes + 8);
+    store_le(crc, 4, bytes + 12);
+    store_le(first_key, 8, bytes + 16);
+    store_le(crc32_fast(bytes, 24), 4, bytes + 24);
+    store_le(0, 4, bytes + 28);
+  }
+
+  // false if the bytes are not a block header
+  bool load(const uint8_t *bytes) {
+    if (load_le(bytes, 4) != block_magic ||
+        load_le(bytes + 24, 4) != crc32_fast(bytes, 24)) {
+      return false;
+    }
+    record_count = static_cast<uint32_t>(load_le(bytes + 4, 4));
+    size = static_cast<uint32_t>(load_le(bytes + 8, 4));
+    crc = static_cast<uint32_t>(load_le(bytes + 12, 4));
+    first_key = load_le(bytes + 16, 8);
+    return true;
+  }
+};
+
+// decode a varint in bytes[index, end)
+inline bool read_block_varint(uint64_t &value, const uint8_t *bytes,
+                              std::size_t &index, std::size_t end) {
+  value = 0;
+  for (std::size_t i = 0; i < 10 && index < end; ++i) {
+    const auto byte = bytes[index++];
+    value |= static_cast<uint64_t>(byte & 127) << (7 * i);
+    if (!(byte & 128)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+} // namespace detail
+
+// Writes records of T (with N fields) to a block file
+// Records are buffered until a block is full, then the block is written to
+// the file as a whole
+template <typename T, options O = options::none,
+          std::size_t N = detail::arity_or_zero<T>()>
+class block_writer {
+public:
+  // `block_size` is the number of record bytes after which a block is cut
+  // records larger than `max_record_size` (at most what a block can hold)
+  // are rejected with std::errc::value_too_large
+  explicit block_writer(
+      std::size_t block_size = detail::default_block_size,
+      std::size_t max_record_size = detail::max_block_record_size)
+      : block_size_(block_size),
+        max_record_size_(
+            std::min(max_record_size, detail::max_block_record_size)) {}
+
+  // closes the file, ignoring errors - call close() to see them
+  ~block_writer() {
+    std::error_code error_code;
+    close(error_code);
+  }
+
+  block_writer(const block_writer &) = delete;
+  block_writer &operator=(const block_writer &) = delete;
+
+  // Create (or truncate) the file at `path`
+  bool open(const std::string &path, std::error_code &error_code) {
+    close(error_code);
+    stream_.open(path, std::ios::out | std::ios::binary | std::ios::trunc);
+    if (!stream_) {
+      error_code = std::make_error_code(std::errc::io_error);
+      return false;
+    }
+
+    uint8_t header[detail::block_file_header_size];
+    detail::store_le(detail::block_file_magic, 4, header);
+    detail::store_le(detail::block_file_version, 4, header + 4);
+    write_bytes(header, sizeof(header), error_code);
+
+    offset_ = sizeof(header);
+    num_records_ = 0;
+    index_.clear();
+    return !error_code;
+  }
+
+  // Append a record with the given key
+  // Keys must not decrease, otherwise std::errc::invalid_argument
+  // A record that is too large is not written, std::errc::value_too_large
+  // Either way the writer goes on with the next record
+  void write(const T &record, uint64_t key, std::error_code &error_code) {
+    if (!stream_.is_open()) {
+      error_code = std::make_error_code(std::errc::bad_file_descriptor);
+      return;
+    }
+    if (num_records_ > 0 && key < last_key_) {
+      error_code = std::make_error_code(std::errc::invalid_argument);
+      return;
+    }
+
+    record_.clear();
+    const auto size = serialize<O, T, N>(record, record_);
+    if (size > max_record_size_) {
+      error_code = std::make_error_code(std::errc::value_too_large);
+      return;
+    }
+
+    if (block_.size() + size > detail::max_block_record_size) {
+      // the block would outgrow its 32-bit size, start a new one
+      write_block(error_code);
+    }
+
+    if (record_count_ == 0) {
+      first_key_ = key;
+    }
+
+    std::size_t index = block_.size();
+    detail::encode_varint_7<uint64_t>(key - first_key_, block_, index);
+    detail::encode_varint_7<std::size_t>(size, block_, index);
+    detail::append_bytes(record_.data(), size, block_, index);
+    ++record_count_;
+    ++num_records_;
+    last_key_ = key;
+
+    if (block_.size() >= block_size_) {
+      write_block(error_code);
+    }
+  }
+
+  // Append a record keyed by its record number
+  void write(const T &record, std::error_code &error_code) {
+    write(record, num_records_, error_code);
+  }
+
+  // Number of records written so far
+  std::size_t size() const noexcept { return num_records_; }
+
+  // End the current block and write it to the file
+  // Everything written before a flush survives a crash
+  void flush(std::error_code &error_code) {
+    write_block(error_code);
+    stream_.flush();
+    if (!stream_) {
+      error_code = std::make_error_code(std::errc::io_error);
+    }
+  }
+
+  // Write the last block, the index and the trailer, and close the file
+  void close(std::error_code &error_code) {
+    if (!stream_.is_open()) {
+      return;
+    }
+
+    write_block(error_code);
+
+    const auto index_offset = offset_;
+    const auto num_blocks = index_.size() / detail::block_index_entry_size;
+    write_bytes(index_.data(), index_.size(), error_code);
+
+    uint8_t trailer[detail::block_file_trailer_size];
+    detail::store_le(index_offset, 8, trailer);
+    detail::store_le(num_blocks, 8, trailer + 8);
+    detail::store_le(num_records_, 8, trailer + 16);
+    detail::store_le(crc32_fast(index_.data(), index_.size()), 4,
+                     trailer + 24);
+    detail::store_le(detail::block_index_magic, 4, trailer + 28);
+    write_bytes(trailer, sizeof(trailer), error_code);
+
+    stream_.close();
+    if (!stream_) {
+      error_code = std::make_error_code(std::errc::io_error);
+    }
+  }
+
+private:
+  void write_block(std::error_code &error_code) {
+    if (record_count_ == 0) {
+      return;
+    }
+
+    uint8_t header[detail::block_header_size];
+    detail::block_header{static_cast<uint32_t>(record_count_),
+                         static_cast<uint32_t>(block_.size()),
+                         crc32_fast(block_.data(), block_.size()), first_key_}
+        .store(header);
+    write_bytes(header, sizeof(header), error_code);
+    write_bytes(block_.data(), block_.size(), error_code);
+
+    const auto entry = index_.size();
+    index_.resize(entry + detail::block_index_entry_size);
+    detail::block_entry{offset_, num_records_ - record_count_, first_key_,
+                        static_cast<uint32_t>(record_count_)}
+        .store(index_.data() + entry);
+
+    offset_ += sizeof(header) + block_.size();
+    block_.clear();
+    record_count_ = 0;
+  }
+
+  void write_bytes(const uint8_t *data, std::size_t size,
+                   std::error_code &error_code) {
+    if (size == 0) {
+      return;
+    }
+    stream_.write(reinterpret_cast<const char *>(data),
+                  static_cast<std::streamsize>(size));
+    if (!stream_) {
+      error_code = std::make_error_code(std::errc::io_error);
+    }
+  }
+
+  std::size_t block_size_;
+  std::size_t max_record_size_;
+  std::ofstream stream_;
+  uint64_t offset_{0};
+  uint64_t num_records_{0};
+  uint64_t last_key_{0};
+
+  // the block being filled
+  std::vector<uint8_t> block_;
+  std::size_t record_count_{0};
+  uint64_t first_key_{0};
+
+  std::vector<uint8_t> index_;
+  std::vector<uint8_t> record_;
+};
+
+// Reads records of T (with N fields) from a block file, in order from any
+// record number or key
+template <typename T, options O = options::none,
+          std::size_t N = detail::arity_or_zero<T>()>
+class block_reader {
+public:
+  block_reader() = default;
+
+  block_reader(const block_reader &) = delete;
+  block_reader &operator=(const block_reader &) = delete;
+
+  // Open the file at `path` and position the reader at the first record
+  // If the file has no valid index, e.g., it was not closed, the index is
+  // rebuilt from the blocks that were written completely, see recovered()
+  bool open(const std::string &path, std::error_code &error_code) {
+    stream_.close();
+    stream_.clear();
+    stream_.open(path, std::ios::in | std::ios::binary);
+    if (!stream_) {
+      error_code = std::make_error_code(std::errc::no_such_file_or_directory);
+      return false;
+    }
+
+    stream_.seekg(0, std::ios::end);
+    file_size_ = static_cast<uint64_t>(stream_.tellg());
+
+    uint8_t header[detail::block_file_header_size];
+    if (!read_at(0, header, sizeof(header)) ||
+        detail::load_le(header, 4) != detail::block_file_magic ||
+        detail::load_le(header + 4, 4) != detail::block_file_version) {
+      error_code = std::make_error_code(std::errc::invalid_argument);
+      return false;
+    }
+
+    recovered_ = !open_index(path);
+    if (recovered_) {
+      recover();
+    }
+
+    rewind();
+    return true;
+  }
+
+  // Number of records in the file
+  std::size_t size() const noexcept { return num_records_; }
+
+  std::size_t num_blocks() const noexcept { return num_blocks_; }
+
+  // true if the index was rebuilt because the file was not closed
+  bool recovered() const noexcept { return recovered_; }
+
+  // Position the reader at the first record
+  void rewind() {
+    next_block_ = 0;
+    remaining_ = 0;
+  }
+
+  // Position the reader at record number `record_number`
+  // Seeking to size() positions the reader at the end
+  bool seek(std::size_t record_number, std::error_code &error_code) {
+    if (record_number > num_records_) {
+      error_code = std::make_error_code(std::errc::result_out_of_range);
+      return false;
+    }
+    if (record_number == num_records_) {
+      next_block_ = num_blocks_;
+      remaining_ = 0;
+      return true;
+    }
+
+    // the last block that starts at or before the record
+    std::size_t first = 0, last = num_blocks_;
+    while (last - first > 1) {
+      const auto middle = first + (last - first) / 2;
+      if (entry(middle).first_record <= record_number) {
+        first = middle;
+      } else {
+        last = middle;
+      }
+    }
+
+    if (!load_block(first, error_code)) {
+      return false;
+    }
+    for (auto i = entry(first).first_record; i < record_number; ++i) {
+      if (!skip_record(error_code)) {
+        return false;
+      }
+    }
+    return true;
+  }
+
+  // Position the reader at the first record with a key of at least `key`
+  bool seek_key(uint64_t key, std::error_code &error_code) {
+    // the first block that starts at or after the key
+    std::size_t first = 0, last = num_blocks_;
+    while (first < last) {
+      const auto middle = first + (last - first) / 2;
+      if (entry(middle).first_key < key) {
+        first = middle + 1;
+      } else {
+        last = middle;
+      }
+    }
+
+    next_block_ = first;
+    remaining_ = 0;
+    if (first == 0) {
+      return true;
+    }
+
+    // the record may be in the block before
+    if (!load_block(first - 1, error_code)) {
+      return false;
+    }
+    while (remaining_ > 0) {
+      const auto cursor = cursor_;
+      uint64_t record_key = 0;
+      std::size_t size = 0;
+      if (!read_record_header(record_key, size, error_code)) {
+        return false;
+      }
+      if (record_key >= key) {
+        cursor_ = cursor;
+        return true;
+      }
+      cursor_ += size;
+      --remaining_;
+    }
+    return true;
+  }
+
+  // Read the next record into `record`
+  // Returns false at the end of the file, or on error with error_code set
+  bool next(T &record, std::error_code &error_code) {
+    while (remaining_ == 0) {
+      if (next_block_ >= num_blocks_) {
+        return false;
+      }
+      if (!load_block(next_block_, error_code)) {
+        return false;
+      }
+    }
+
+    std::size_t size = 0;
+    if (!read_record_header(key_, size, error_code)) {
+      return false;
+    }
+
+    const byte_span bytes(block_.data() + cursor_, size);
+    cursor_ += size;
+    --remaining_;
+
+    record = T{};
+    std::size_t byte_index = 0;
+    std::size_t end_index = size;
+    deserialize<O, T, N>(record, bytes, byte_index, end_index, error_code);
+    return !error_code;
+  }
+
+  // The key of the record last read by next()
+  uint64_t key() const noexcept { return key_; }
+
+private:
+  // use the index at the end of the file, if there is a valid one
+  bool open_index(const std::string &path) {
+    if (file_size_ <
+        detail::block_file_header_size + detail::block_file_trailer_size) {
+      return false;
+    }
+
+    uint8_t trailer[detail::block_file_trailer_size];
+    if (!read_at(file_size_ - sizeof(trailer), trailer, sizeof(trailer)) ||
+        detail::load_le(trailer + 28, 4) != detail::block_index_magic) {
+      return false;
+    }
+
+    const auto index_offset = detail::load_le(trailer, 8);
+    const auto num_blocks = detail::load_le(trailer + 8, 8);
+    if (index_offset < detail::block_file_header_size ||
+        index_offset > file_size_ - sizeof(trailer) ||
+        (file_size_ - sizeof(trailer) - index_offset) !=
+            num_blocks * detail::block_index_entry_size) {
+      return false;
+    }
+
+    std::error_code error_code;
+    if (!footer_.map(path, index_offset,
+                     num_blocks * detail::block_index_entry_size,
+                     error_code) ||
+        detail::load_le(trailer + 24, 4) !=
+            crc32_fast(footer_.data(), footer_.size())) {
+      return false;
+    }
+
+    index_ = footer_.data();
+    num_blocks_ = num_blocks;
+    num_records_ = detail::load_le(trailer + 16, 8);
+    return true;
+  }
+
+  // rebuild the index from the block headers
+  void recover() {
+    recovered_index_.clear();
+    num_records_ = 0;
+
+    uint8_t header_bytes[detail::block_header_size];
+    detail::block_header header{};
+    uint64_t offset = detail::block_file_header_size;
+    while (offset + sizeof(header_bytes) <= file_size_ &&
+           read_at(offset, header_bytes, sizeof(header_bytes)) &&
+           header.load(header_bytes) &&
+           offset + sizeof(header_bytes) + header.size <= file_size_) {
+      const auto entry = recovered_index_.size();
+      recovered_index_.resize(entry + detail::block_index_entry_size);
+      detail::block_entry{offset, num_records_, header.first_key,
+                          header.record_count}
+          .store(recovered_index_.data() + entry);
+      num_records_ += header.record_count;
+      offset += sizeof(header_bytes) + header.size;
+    }
+
+    index_ = recovered_index_.data();
+    num_blocks_ = recovered_index_.size() / detail::block_index_entry_size;
+
+    // only the last block can be incomplete
+    if (num_blocks_ > 0) {
+      std::error_code block_error;
+      if (!load_block(num_blocks_ - 1, block_error)) {
+        num_records_ -= entry(num_blocks_ - 1).record_count;
+        --num_blocks_;
+        recovered_index_.resize(num_blocks_ *
+                                detail::block_index_entry_size);
+        index_ = recovered_index_.data();
+      }
+    }
+  }
+
+  detail::block_entry entry(std::size_t block) const {
+    return detail::block_entry::load(index_ +
+                                     block * detail::block_index_entry_size);
+  }
+
+  // read and check block `block`, and position the reader at its first record
+  bool load_block(std::size_t block, std::error_code &error_code) {
+    const auto block_entry = entry(block);
+
+    uint8_t header_bytes[detail::block_header_size];
+    detail::block_header header{};
+    if (!read_at(block_entry.offset, header_bytes, sizeof(header_bytes)) ||
+        !header.load(header_bytes)) {
+      error_code = std::make_error_code(std::errc::bad_message);
+      return false;
+    }
+
+    block_.resize(header.size);
+    if (!read_at(block_entry.offset + sizeof(header_bytes), block_.data(),
+                 block_.size()) ||
+        crc32_fast(block_.data(), block_.size()) != header.crc) {
+      error_code = std::make_error_code(std::errc::bad_message);
+      return false;
+    }
+
+    first_key_ = header.first_key;
+    cursor_ = 0;
+    remaining_ = header.record_count;
+    next_block_ = block + 1;
+    return true;
+  }
+
+  bool read_record_header(uint64_t &key, std::size_t &size,
+                          std::error_code &error_code) {
+    uint64_t delta = 0, record_size = 0;
+    if (!detail::read_block_varint(delta, block_.data(), cursor_,
+                                   block_.size()) ||
+        !detail::read_block_varint(record_size, block_.data(), cursor_,
+                                   block_.size()) ||
+        record_size > block_.size() - cursor_) {
+      error_code = std::make_error_code(std::errc::illegal_byte_sequence);
+      return false;
+    }
+    key = first_key_ + delta;
+    size = static_cast<std::size_t>(record_size);
+    return true;
+  }
+
+  bool skip_record(std::error_code &error_code) {
+    uint64_t key = 0;
+    std::size_t size = 0;
+    if (!read_record_header(key, size, error_code)) {
+      return false;
+    }
+    cursor_ += size;
+    --remaining_;
+    return true;
+  }
+
+  bool read_at(uint64_t offset, uint8_t *data, std::size_t size) {
+    stream_.clear();
+    stream_.seekg(static_cast<std::streamoff>(offset));
+    stream_.read(reinterpret_cast<char *>(data),
+                 static_cast<std::streamsize>(size));
+    return static_cast<std::size_t>(stream_.gcount()) == size;
+  }
+
+  std::ifstream stream_;
+  uint64_t file_size_{0};
+  bool recovered_{false};
+
+  // index entries, in the mapped footer or rebuilt by recover()
+  const uint8_t *index_{nullptr};
+  detail::mapped_region footer_;
+  std::vector<uint8_t> recovered_index_;
+  std::size_t num_blocks_{0};
+  std::size_t num_records_{0};
+
+  // the block being read
+  std::vector<uint8_t> block_;
+  uint64_t first_key_{0};
+  std::size_t cursor_{0};
+  std::size_t remaining_{0};
+  std::size_t next_block_{0};
+  uint64_t key_{0};
+};
+
+} // namespace alpaca
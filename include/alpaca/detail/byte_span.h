@@ -0,0 +1,47 @@
+#pragma once
+#include <cstddef>
+#include <cstdint>
+
+namespace alpaca {
+
+// Non-owning view of a serialized message, i.e., std::span<const uint8_t>
+// for C++17
+// Can be passed to deserialize, validate and skip in place of a container
+class byte_span {
+public:
+  constexpr byte_span() noexcept = default;
+
+  constexpr byte_span(const uint8_t *data, std::size_t size) noexcept
+      : data_(data), size_(size) {}
+
+  // view of a std::vector<uint8_t>, std::array<uint8_t, N>, etc.
+  template <typename Container>
+  constexpr byte_span(const Container &bytes) noexcept
+      : data_(bytes.data()), size_(bytes.size()) {}
+
+  constexpr const uint8_t *data() const noexcept { return data_; }
+
+  constexpr std::size_t size() const noexcept { return size_; }
+
+  constexpr bool empty() const noexcept { return size_ == 0; }
+
+  constexpr const uint8_t &operator[](std::size_t index) const noexcept {
+    return data_[index];
+  }
+
+  constexpr const uint8_t *begin() const noexcept { return data_; }
+
+  constexpr const uint8_t *end() const noexcept { return data_ + size_; }
+
+  // the `size` bytes starting at `offset`
+  constexpr byte_span subspan(std::size_t offset,
+                              std::size_t size) const noexcept {
+    return byte_span{data_ + offset, size};
+  }
+
+private:
+  const uint8_t *data_{nullptr};
+  std::size_t size_{0};
+};
+
+} // namespace alpaca
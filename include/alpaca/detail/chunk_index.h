@@ -0,0 +1,104 @@
+#pragma once
+#include <alpaca/detail/options.h>
+#include <alpaca/detail/output_container.h>
+#include <cstddef>
+#include <cstdint>
+
+namespace alpaca {
+
+namespace detail {
+
+// With options::with_chunk_index, a vector of more than vector_chunk_size
+// variable-size elements is written as
+//
+//   size | chunk 0 size | ... | chunk k-1 size | elements
+//
+// where chunk i holds elements [i * vector_chunk_size, (i + 1) *
+// vector_chunk_size) and each chunk size is the number of bytes the chunk
+// takes, as a fixed-width uint64_t in the byte order set by the options.
+// Chunks can then be decoded independently of each other.
+constexpr std::size_t vector_chunk_size = 4096;
+
+constexpr std::size_t chunk_size_bytes = sizeof(uint64_t);
+
+constexpr std::size_t num_vector_chunks(std::size_t size) {
+  return (size + vector_chunk_size - 1) / vector_chunk_size;
+}
+
+template <options O, typename Container>
+void write_chunk_size(uint64_t value, Container &bytes, std::size_t &index) {
+  for (std::size_t i = 0; i < chunk_size_bytes; ++i) {
+    const auto shift = 8 * (big_endian<O>() ? chunk_size_bytes - 1 - i : i);
+    append(static_cast<uint8_t>(value >> shift), bytes, index);
+  }
+}
+
+// overwrite the chunk size written at `index`
+template <options O, typename Container>
+void patch_chunk_size(uint64_t value, Container &bytes, std::size_t index) {
+  for (std::size_t i = 0; i < chunk_size_bytes; ++i) {
+    const auto shift = 8 * (big_endian<O>() ? chunk_size_bytes - 1 - i : i);
+    bytes[index + i] = static_cast<uint8_t>(value >> shift);
+  }
+}
+
+template <options O, typename Container>
+uint64_t read_chunk_size(Container &bytes, std::size_t index) {
+  uint64_t value = 0;
+  for (std::size_t i = 0; i < chunk_size_bytes; ++i) {
+    const auto shift = 8 * (big_endian<O>() ? chunk_size_bytes - 1 - i : i);
+    value |= static_cast<uint64_t>(static_cast<uint8_t>(bytes[index + i]))
+             << shift;
+  }
+  return value;
+}
+
+// Type-erased executor used to decode chunks in parallel
+// See deserialize_parallel in alpaca/batch.h
+class decode_executor {
+  using task_function = void (*)(void *, std::size_t);
+
+public:
+  template <typename Executor>
+  explicit decode_executor(Executor &executor)
+      : executor_(&executor),
+        execute_([](void *executor, std::size_t num_tasks, task_function task,
+                    void *context) {
+          static_cast<Executor *>(executor)->execute(
+              num_tasks, [&](std::size_t i) { task(context, i); });
+        }) {}
+
+  template <typename F> void execute(std::size_t num_tasks, F &f) {
+    execute_(
+        executor_, num_tasks,
+        [](void *context, std::size_t i) { (*static_cast<F *>(context))(i); },
+        &f);
+  }
+
+private:
+  void *executor_;
+  void (*execute_)(void *, std::size_t, task_function, void *);
+};
+
+// nullptr when chunks are decoded on the calling thread
+inline thread_local decode_executor *current_decode_executor = nullptr;
+
+// installs an executor (or none) for the lifetime of the scope
+class decode_executor_scope {
+  decode_executor *previous_;
+
+public:
+  explicit decode_executor_scope(decode_executor *executor)
+      : previous_(current_decode_executor) {
+    current_decode_executor = executor;
+  }
+
+  ~decode_executor_scope() { current_decode_executor = previous_; }
+
+  decode_executor_scope(const decode_executor_scope &) = delete;
+  decode_executor_scope &operator=(const decode_executor_scope &) = delete;
+};
+
+} // namespace detail
+
+} // namespace alpaca
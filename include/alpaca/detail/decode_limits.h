@@ -0,0 +1,113 @@
+#pragma once
+#include <cstddef>
+#include <limits>
+#include <system_error>
+
+namespace alpaca {
+
+// Upper bounds on the resources a single deserialize call may use
+// Any limit that is exceeded stops deserialization with an error
+struct decode_limits {
+  // total bytes allocated for container elements
+  // exceeded -> std::errc::not_enough_memory
+  std::size_t max_bytes_allocated = std::numeric_limits<std::size_t>::max();
+
+  // number of elements in any one container
+  // exceeded -> std::errc::value_too_large
+  std::size_t max_elements = std::numeric_limits<std::size_t>::max();
+
+  // nesting depth of containers and pointers
+  // exceeded -> std::errc::result_out_of_range
+  std::size_t max_depth = std::numeric_limits<std::size_t>::max();
+};
+
+namespace detail {
+
+// limits and running totals of the deserialize call on this thread
+struct decode_context {
+  decode_limits limits;
+  std::size_t bytes_allocated{0};
+  std::size_t depth{0};
+};
+
+// nullptr when no limits are in place
+inline thread_local decode_context *current_decode_context = nullptr;
+
+// installs a decode context for the lifetime of the scope
+class decode_context_scope {
+  decode_context context_;
+  decode_context *previous_;
+
+public:
+  explicit decode_context_scope(const decode_limits &limits)
+      : context_{limits}, previous_(current_decode_context) {
+    current_decode_context = &context_;
+  }
+
+  ~decode_context_scope() { current_decode_context = previous_; }
+
+  decode_context_scope(const decode_context_scope &) = delete;
+  decode_context_scope &operator=(const decode_context_scope &) = delete;
+};
+
+// account for `size` elements of type T that are about to be decoded
+// returns false if this would exceed the limits
+template <typename T>
+bool check_decode_limits(std::size_t size, std::error_code &error_code) {
+  auto context = current_decode_context;
+  if (context == nullptr) {
+    return true;
+  }
+
+  if (size > context->limits.max_elements) {
+    error_code = std::make_error_code(std::errc::value_too_large);
+    return false;
+  }
+
+  const auto remaining =
+      context->limits.max_bytes_allocated - context->bytes_allocated;
+  if (size > remaining / sizeof(T)) {
+    error_code = std::make_error_code(std::errc::not_enough_memory);
+    return false;
+  }
+
+  context->bytes_allocated += size * sizeof(T);
+  return true;
+}
+
+// one more level of nesting for the lifetime of the guard
+// converts to false if this would exceed the depth limit
+class depth_guard {
+  decode_context *context_;
+  bool ok_{true};
+
+public:
+  explicit depth_guard(std::error_code &error_code)
+      : context_(current_decode_context) {
+    if (context_ == nullptr) {
+      return;
+    }
+    if (context_->depth >= context_->limits.max_depth) {
+      error_code = std::make_error_code(std::errc::result_out_of_range);
+      context_ = nullptr;
+      ok_ = false;
+      return;
+    }
+    ++context_->depth;
+  }
+
+  ~depth_guard() {
+    if (context_ != nullptr) {
+      --context_->depth;
+    }
+  }
+
+  depth_guard(const depth_guard &) = delete;
+  depth_guard &operator=(const depth_guard &) = delete;
+
+  explicit operator bool() const { return ok_; }
+};
+
+} // namespace detail
+
+} // namespace alpaca
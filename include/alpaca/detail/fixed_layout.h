@@ -0,0 +1,142 @@
+#pragma once
+#include <alpaca/detail/aggregate_arity.h>
+#include <alpaca/detail/endian.h>
+#include <alpaca/detail/from_bytes.h>
+#include <alpaca/detail/options.h>
+#include <alpaca/detail/output_container.h>
+#include <alpaca/detail/struct_nth_field.h>
+#include <alpaca/detail/type_info.h>
+#include <array>
+#include <cstdint>
+#include <type_traits>
+#include <utility>
+
+namespace alpaca {
+
+namespace detail {
+
+// number of fields for aggregates, 0 for every other type
+template <typename T> constexpr std::size_t arity_or_zero() {
+  if constexpr (std::is_aggregate_v<T> && !is_array_type<T>::value) {
+    return aggregate_arity<std::remove_cv_t<T>>::size();
+  } else {
+    return 0;
+  }
+}
+
+template <options O, typename T, std::size_t N, std::size_t... I>
+constexpr std::size_t fixed_fields_size(std::index_sequence<I...>);
+
+// Serialized size of T (with N fields) under options O, if it is the same for
+// every value of T - e.g., structs of floats and fixed-width integers, and
+// std::arrays of them.
+// 0 if the size depends on the value, e.g., varints and containers
+template <options O, typename T, std::size_t N = arity_or_zero<T>()>
+constexpr std::size_t fixed_serialized_size() {
+  if constexpr (std::is_same_v<T, int8_t> || std::is_same_v<T, int16_t> ||
+                std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> ||
+                std::is_same_v<T, char> || std::is_same_v<T, wchar_t> ||
+                std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t> ||
+                std::is_same_v<T, bool> || std::is_same_v<T, float> ||
+                std::is_same_v<T, double>) {
+    // stored as is
+    return sizeof(T);
+  } else if constexpr (std::is_same_v<T, int32_t> || std::is_same_v<T, long> ||
+                       std::is_same_v<T, int64_t> ||
+                       std::is_same_v<T, uint32_t> ||
+                       std::is_same_v<T, uint64_t> ||
+                       std::is_same_v<T, std::size_t>) {
+    // fixed size only if varints are not used
+    constexpr auto use_fixed_length_encoding =
+        ((is_system_little_endian() && detail::big_endian<O>()) ||
+         (detail::fixed_length_encoding<O>()));
+    if constexpr (use_fixed_length_encoding) {
+      return sizeof(map_size_t_to_type_t<T>);
+    } else {
+      return 0;
+    }
+  } else if constexpr (std::is_enum_v<T>) {
+    return fixed_serialized_size<O, std::underlying_type_t<T>>();
+  } else if constexpr (is_array_type<T>::value) {
+    return std::tuple_size_v<T> *
+           fixed_serialized_size<O, typename T::value_type>();
+  } else if constexpr (std::is_aggregate_v<T> && N > 0) {
+    return fixed_fields_size<O, T, N>(std::make_index_sequence<N>{});
+  } else {
+    return 0;
+  }
+}
+
+template <options O, typename T, std::size_t N, std::size_t... I>
+constexpr std::size_t fixed_fields_size(std::index_sequence<I...>) {
+  constexpr std::size_t sizes[] = {
+      fixed_serialized_size<O, nth_field_type_t<T, N, I>>()...};
+  std::size_t result = 0;
+  for (auto size : sizes) {
+    if (size == 0) {
+      // one variable-size field makes the whole struct variable-size
+      return 0;
+    }
+    result += size;
+  }
+  return result;
+}
+
+// true if the serialized bytes of T are exactly its bytes in memory,
+// i.e., fixed size, no padding and native byte order
+template <options O, typename T, std::size_t N = arity_or_zero<T>()>
+constexpr bool has_serialized_layout() {
+  constexpr bool native_byte_order =
+      (is_system_little_endian() && detail::little_endian<O>()) ||
+      (is_system_big_endian() && detail::big_endian<O>());
+  return native_byte_order && std::is_trivially_copyable_v<T> &&
+         fixed_serialized_size<O, T, N>() == sizeof(T);
+}
+
+template <options O, typename T, typename Container>
+void to_bytes_router(const T &input, Container &bytes, std::size_t &byte_index);
+
+// encode every field of T (with N fields), in order
+template <options O, typename T, std::size_t N, typename Container,
+          std::size_t... I>
+void to_bytes_fields(const T &input, Container &bytes, std::size_t &byte_index,
+                     std::index_sequence<I...>) {
+  (to_bytes_router<O>(get<I, const T, N>(input), bytes, byte_index), ...);
+}
+
+// Write a fixed-size T (with N fields) in one go
+// Either the object is copied as is, or its fields are encoded into a local
+// buffer with straight-line stores and the buffer is appended to the output
+template <options O, typename T, std::size_t N, typename Container>
+void to_bytes_fixed(const T &input, Container &bytes,
+                    std::size_t &byte_index) {
+  constexpr auto size = fixed_serialized_size<O, T, N>();
+  static_assert(size > 0, "T does not have a fixed layout");
+
+  if constexpr (has_serialized_layout<O, T, N>()) {
+    append_bytes(reinterpret_cast<const uint8_t *>(&input), size, bytes,
+                 byte_index);
+  } else {
+    std::array<uint8_t, size> buffer;
+    std::size_t index = 0;
+    if constexpr (is_array_type<T>::value) {
+      for (const auto &v : input) {
+        to_bytes_router<O>(v, buffer, index);
+      }
+    } else {
+      to_bytes_fields<O, T, N>(input, buffer, index,
+                               std::make_index_sequence<N>{});
+    }
+    append_bytes(buffer.data(), size, bytes, byte_index);
+  }
+}
+
+} // namespace detail
+
+// Serialized size of T under options O, if it is the same for every value of
+// T, otherwise 0
+template <typename T, options O = options::none>
+inline constexpr std::size_t fixed_serialized_size_v =
+    detail::fixed_serialized_size<O, T>();
+
+} // namespace alpaca
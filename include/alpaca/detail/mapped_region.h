@@ -0,0 +1,111 @@
+#pragma once
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <system_error>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define ALPACA_HAS_MMAP
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <unistd.h>
+#endif
+
+namespace alpaca {
+
+namespace detail {
+
+// Read-only view of the bytes [offset, offset + size) of a file
+// Memory-mapped where mmap is available, read into memory otherwise
+class mapped_region {
+public:
+  mapped_region() = default;
+
+  ~mapped_region() { unmap(); }
+
+  mapped_region(const mapped_region &) = delete;
+  mapped_region &operator=(const mapped_region &) = delete;
+
+  bool map(const std::string &path, std::size_t offset, std::size_t size,
+           std::error_code &error_code) {
+    unmap();
+    if (size == 0) {
+      return true;
+    }
+
+#ifdef ALPACA_HAS_MMAP
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+      error_code = std::error_code(errno, std::generic_category());
+      return false;
+    }
+
+    // mappings start at a page boundary
+    const auto page_size = static_cast<std::size_t>(::sysconf(_SC_PAGESIZE));
+    const auto aligned_offset = offset - offset % page_size;
+    const auto mapping_size = size + (offset - aligned_offset);
+
+    void *mapping = ::mmap(nullptr, mapping_size, PROT_READ, MAP_PRIVATE, fd,
+                           static_cast<off_t>(aligned_offset));
+    ::close(fd);
+    if (mapping == MAP_FAILED) {
+      error_code = std::error_code(errno, std::generic_category());
+      return false;
+    }
+
+    mapping_ = mapping;
+    mapping_size_ = mapping_size;
+    data_ = static_cast<const uint8_t *>(mapping) + (offset - aligned_offset);
+#else
+    std::ifstream stream(path, std::ios::in | std::ios::binary);
+    buffer_.resize(size);
+    stream.seekg(static_cast<std::streamoff>(offset));
+    stream.read(reinterpret_cast<char *>(buffer_.data()),
+                static_cast<std::streamsize>(size));
+    if (!stream) {
+      buffer_.clear();
+      error_code = std::make_error_code(std::errc::io_error);
+      return false;
+    }
+    data_ = buffer_.data();
+#endif
+
+    size_ = size;
+    return true;
+  }
+
+  const uint8_t *data() const noexcept { return data_; }
+
+  std::size_t size() const noexcept { return size_; }
+
+private:
+  void unmap() {
+#ifdef ALPACA_HAS_MMAP
+    if (mapping_ != nullptr) {
+      ::munmap(mapping_, mapping_size_);
+      mapping_ = nullptr;
+    }
+#else
+    buffer_.clear();
+#endif
+    data_ = nullptr;
+    size_ = 0;
+  }
+
+  const uint8_t *data_{nullptr};
+  std::size_t size_{0};
+
+#ifdef ALPACA_HAS_MMAP
+  void *mapping_{nullptr};
+  std::size_t mapping_size_{0};
+#else
+  std::vector<uint8_t> buffer_;
+#endif
+};
+
+} // namespace detail
+
+} // namespace alpaca
@@ -8,7 +8,8 @@ enum class options {
   big_endian = 1,
   fixed_length_encoding = 2,
   with_version = 4,
-  with_checksum = 8
+  with_checksum = 8,
+  with_chunk_index = 16
 };
 
 template <typename E> struct enable_bitmask_operators {
@@ -49,6 +50,19 @@ template <options O> constexpr bool with_checksum() {
   return enum_has_flag<options, O, options::with_checksum>();
 }
 
+template <options O> constexpr bool with_chunk_index() {
+  return enum_has_flag<options, O, options::with_chunk_index>();
+}
+
+// Set only by alpaca::profile, and never changes the bytes
+// Instrumented calls are separate instantiations from the plain ones, so a
+// type can be profiled in one translation unit and not in another
+constexpr auto profile_fields_flag = static_cast<options>(1 << 30);
+
+template <options O> constexpr bool profile_fields() {
+  return enum_has_flag<options, O, profile_fields_flag>();
+}
+
 } // namespace detail
 
 template <> struct enable_bitmask_operators<options> {
@@ -1,5 +1,6 @@
 #pragma once
 #include <array>
+#include <cstring>
 #include <fstream>
 #include <system_error>
 #include <vector>
@@ -31,6 +32,35 @@ static inline void append(const uint8_t &value, std::ofstream &container,
   index += 1;
 }
 
+// append a block of bytes at once
+
+static inline void append_bytes(const uint8_t *data, std::size_t size,
+                                std::vector<uint8_t> &container,
+                                std::size_t &index) {
+  container.insert(container.end(), data, data + size);
+  index += size;
+}
+
+template <std::size_t N>
+void append_bytes(const uint8_t *data, std::size_t size,
+                  std::array<uint8_t, N> &container, std::size_t &index) {
+  std::memcpy(container.data() + index, data, size);
+  index += size;
+}
+
+static inline void append_bytes(const uint8_t *data, std::size_t size,
+                                uint8_t container[], std::size_t &index) {
+  std::memcpy(container + index, data, size);
+  index += size;
+}
+
+static inline void append_bytes(const uint8_t *data, std::size_t size,
+                                std::ofstream &container, std::size_t &index) {
+  container.write(reinterpret_cast<const char *>(data),
+                  static_cast<std::streamsize>(size));
+  index += size;
+}
+
 } // namespace detail
 
 } // namespace alpaca
@@ -0,0 +1,135 @@
+#pragma once
+#include <alpaca/detail/type_info.h>
+#include <chrono>
+#include <cstddef>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+
+namespace alpaca {
+
+// Bytes and time spent on one field path, over every call that reached it
+// Both include the nested fields of the field
+struct profile_stats {
+  std::size_t calls{0};
+  std::size_t bytes{0};
+  std::chrono::nanoseconds time{0};
+};
+
+// One field path of a profiled message, e.g., Player.2[].0 for field 0 of
+// the elements of field 2 of Player
+struct profile_entry {
+  std::string path;
+  std::string_view type;
+  profile_stats serialize;
+  profile_stats deserialize;
+};
+
+namespace detail {
+
+// name of T as the compiler spells it, e.g., "Player" or "std::vector<int>"
+template <typename T> std::string_view type_name() {
+#if defined(_MSC_VER)
+  std::string_view name = __FUNCSIG__;
+  name.remove_prefix(name.find("type_name<") + 10);
+  name.remove_suffix(name.size() - name.rfind(">(void)"));
+  for (std::string_view prefix : {"struct ", "class ", "enum "}) {
+    if (name.substr(0, prefix.size()) == prefix) {
+      name.remove_prefix(prefix.size());
+    }
+  }
+#else
+  std::string_view name = __PRETTY_FUNCTION__;
+  name.remove_prefix(name.find("T = ") + 4);
+  name = name.substr(0, name.find_first_of(";]"));
+#endif
+  return name;
+}
+
+// entries and current field path of the profiled call on this thread
+struct profile_context {
+  std::deque<profile_entry> &entries;
+  std::unordered_map<std::string, std::size_t> &index;
+  bool decoding;
+  std::string path;
+
+  profile_stats &stats(std::string_view type) {
+    auto it = index.find(path);
+    if (it == index.end()) {
+      it = index.emplace(path, entries.size()).first;
+      entries.push_back(profile_entry{path, type, {}, {}});
+    }
+    auto &entry = entries[it->second];
+    return decoding ? entry.deserialize : entry.serialize;
+  }
+};
+
+// nullptr when no profile is collecting
+inline thread_local profile_context *current_profile_context = nullptr;
+
+// installs a profile context for the lifetime of the scope
+class profile_context_scope {
+  profile_context *previous_;
+
+public:
+  explicit profile_context_scope(profile_context &context)
+      : previous_(current_profile_context) {
+    current_profile_context = &context;
+  }
+
+  ~profile_context_scope() { current_profile_context = previous_; }
+
+  profile_context_scope(const profile_context_scope &) = delete;
+  profile_context_scope &operator=(const profile_context_scope &) = delete;
+};
+
+// Adds the bytes and time of the I-th field, of type F, to the current
+// path, for the lifetime of the guard
+// Nested structs of containers, optionals, pointers and variants are under
+// the [] of the field, e.g., Player.2[].0
+template <std::size_t I, typename F> class profile_field_guard {
+  using clock = std::chrono::steady_clock;
+
+  profile_context *context_;
+  const std::size_t &byte_index_;
+  std::size_t start_index_;
+  std::size_t path_size_{0};
+  profile_stats *stats_{nullptr};
+  clock::time_point start_;
+
+public:
+  explicit profile_field_guard(const std::size_t &byte_index)
+      : context_(current_profile_context), byte_index_(byte_index),
+        start_index_(byte_index) {
+    if (context_ == nullptr) {
+      return;
+    }
+    path_size_ = context_->path.size();
+    context_->path += '.';
+    context_->path += std::to_string(I);
+    stats_ = &context_->stats(type_name<F>());
+    if constexpr (!std::is_aggregate_v<F> || is_array_type<F>::value) {
+      context_->path += "[]";
+    }
+    start_ = clock::now();
+  }
+
+  ~profile_field_guard() {
+    if (context_ == nullptr) {
+      return;
+    }
+    stats_->time += clock::now() - start_;
+    stats_->bytes += byte_index_ - start_index_;
+    ++stats_->calls;
+    context_->path.resize(path_size_);
+  }
+
+  profile_field_guard(const profile_field_guard &) = delete;
+  profile_field_guard &operator=(const profile_field_guard &) = delete;
+};
+
+} // namespace detail
+
+} // namespace alpaca
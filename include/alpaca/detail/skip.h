@@ -0,0 +1,321 @@
+#pragma once
+#include <alpaca/detail/aggregate_arity.h>
+#include <alpaca/detail/from_bytes.h>
+#include <alpaca/detail/options.h>
+#include <alpaca/detail/type_info.h>
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_CHRONO
+#include <chrono>
+#endif
+
+#include <cstdint>
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_DEQUE
+#include <deque>
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_LIST
+#include <list>
+#endif
+
+#include <system_error>
+
+namespace alpaca {
+
+namespace detail {
+
+// The skip walker advances `current_index` past a serialized value of type T
+// without constructing it. Only lengths, varint terminators, optional flags
+// and variant indices are parsed - nothing is allocated.
+//
+// Every overload follows the same rules as the matching from_bytes:
+// reaching the end of input before a value starts is not an error (forward
+// compatibility), but a value that is cut short is.
+
+// varint - step over the octets until the continuation bit is clear
+template <typename int_t, typename Container>
+bool skip_varint(Container &bytes, std::size_t &current_index,
+                 std::size_t &end_index, std::error_code &error_code) {
+  // max number of 7-bit octets the encoder emits for int_t
+  constexpr std::size_t max_num_octets = (sizeof(int_t) * 8 + 6) / 7;
+
+  std::size_t index = current_index;
+
+  if constexpr (std::is_signed_v<int_t>) {
+    // first octet has the sign bit and the continuation flag in bit 6
+    if (!(static_cast<uint8_t>(bytes[index++]) & 64)) {
+      current_index = index;
+      return true;
+    }
+  }
+
+  for (std::size_t i = 0; i < max_num_octets; ++i) {
+    if (index >= end_index) {
+      // varint runs past the end of input
+      error_code = std::make_error_code(std::errc::message_size);
+      return false;
+    }
+    if (!(static_cast<uint8_t>(bytes[index++]) & 128)) {
+      current_index = index;
+      return true;
+    }
+  }
+
+  // continuation bit is still set after the max number of octets
+  error_code = std::make_error_code(std::errc::illegal_byte_sequence);
+  return false;
+}
+
+// char, bool, small ints, float, double
+// stored as is
+template <options O, typename T, typename Container>
+typename std::enable_if<
+    std::is_same_v<T, int8_t> || std::is_same_v<T, int16_t> ||
+        std::is_same_v<T, uint8_t> || std::is_same_v<T, uint16_t> ||
+        std::is_same_v<T, char> || std::is_same_v<T, wchar_t> ||
+        std::is_same_v<T, char16_t> || std::is_same_v<T, char32_t> ||
+        std::is_same_v<T, bool> || std::is_same_v<T, float> ||
+        std::is_same_v<T, double>,
+    bool>::type
+skip(Container &, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  if (end_index - current_index < sizeof(T)) {
+    // value is cut short
+    error_code = std::make_error_code(std::errc::message_size);
+    return false;
+  }
+
+  current_index += sizeof(T);
+  return true;
+}
+
+// large ints
+// variable-length or fixed-length encoded
+template <options O, typename T, typename Container>
+typename std::enable_if<
+    std::is_same_v<T, int32_t> || std::is_same_v<T, long> ||
+        std::is_same_v<T, int64_t> || std::is_same_v<T, uint32_t> ||
+        std::is_same_v<T, uint64_t> || std::is_same_v<T, std::size_t>,
+    bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  using ActualType = map_size_t_to_type_t<T>;
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  constexpr auto use_fixed_length_encoding =
+      ((is_system_little_endian() && detail::big_endian<O>()) ||
+       (detail::fixed_length_encoding<O>()));
+
+  if constexpr (use_fixed_length_encoding) {
+    if (end_index - current_index < sizeof(ActualType)) {
+      // value is cut short
+      error_code = std::make_error_code(std::errc::message_size);
+      return false;
+    }
+    current_index += sizeof(ActualType);
+    return true;
+  } else {
+    return skip_varint<ActualType>(bytes, current_index, end_index,
+                                   error_code);
+  }
+}
+
+// enum class
+template <options O, typename T, typename Container>
+typename std::enable_if<std::is_enum_v<T>, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  using underlying_type = typename std::underlying_type<T>::type;
+  return skip<O, underlying_type>(bytes, current_index, end_index,
+                                  error_code);
+}
+
+// read a size_t length prefix, checking bounds before decoding it
+template <options O, typename Container>
+bool read_length(std::size_t &size, Container &bytes,
+                 std::size_t &current_index, std::size_t &end_index,
+                 std::error_code &error_code) {
+  auto index = current_index;
+  if (!skip<O, std::size_t>(bytes, index, end_index, error_code)) {
+    return false;
+  }
+  detail::from_bytes<O, std::size_t>(size, bytes, current_index, end_index,
+                                     error_code);
+  return !error_code;
+}
+
+// Forward declares
+
+// aggregate types
+template <options O, typename T, typename Container>
+typename std::enable_if<std::is_aggregate_v<T> && !is_array_type<T>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_ARRAY
+// array types
+template <options O, typename T, typename Container>
+typename std::enable_if<is_array_type<T>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_BITSET
+// std::bitset type
+template <options O, typename T, typename Container>
+typename std::enable_if<is_bitset<T>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_CHRONO
+// std::chrono::duration
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::chrono::duration>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_DEQUE
+// deque
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::deque>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_FILESYSTEM_PATH
+// filesystem::path
+template <options O, typename T, typename Container>
+typename std::enable_if<std::is_same<T, std::filesystem::path>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_LIST
+// list
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::list>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_MAP
+// map
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::map>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_UNORDERED_MAP
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::unordered_map>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_OPTIONAL
+// optional
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::optional>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_PAIR
+// pair
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::pair>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_SET
+// set
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::set>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_UNORDERED_SET
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::unordered_set>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_STRING
+// string
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::basic_string>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_TUPLE
+// tuple
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::tuple>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_UNIQUE_PTR
+// unique_ptr
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::unique_ptr>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_VARIANT
+// variant
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::variant>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_VECTOR
+// vector
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::vector>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+#ifdef ALPACA_INCLUDE_SUPPORT_GLM_VECTOR
+// glm::vec, see glm_vector.h
+template <typename T> struct is_glm_vec;
+
+template <options O, typename T, typename Container>
+typename std::enable_if<is_glm_vec<T>::value, bool>::type
+skip(Container &bytes, std::size_t &byte_index, std::size_t &end_index,
+     std::error_code &error_code);
+#endif
+
+} // namespace detail
+
+} // namespace alpaca
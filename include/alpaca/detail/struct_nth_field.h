@@ -1,10721 +1,1420 @@
 #pragma once
 #include <alpaca/detail/aggregate_arity.h>
 #include <cstdint>
+#include <type_traits>
+#include <utility>
 
 namespace alpaca {
 
 namespace detail {
 
+// the accessors below are trivial, inline them even in debug builds so that
+// no code is generated for them
+#if defined(_MSC_VER)
+#define ALPACA_FIELD_INLINE __forceinline
+#else
+#define ALPACA_FIELD_INLINE __attribute__((always_inline)) inline
+#endif
+
+template <typename index_sequence> struct pick_field;
+
+// pick_field<std::make_index_sequence<index>>::pick(&p1, &p2, ...) returns the
+// field that the argument at `index` points to
+// the fields before it only need a pointer conversion to be skipped
+template <std::size_t... skipped>
+struct pick_field<std::index_sequence<skipped...>> {
+  template <typename type>
+  ALPACA_FIELD_INLINE static constexpr type &
+  pick(decltype((void)skipped, static_cast<const volatile void *>(nullptr))...,
+       type *field, ...) noexcept {
+    return *field;
+  }
+};
+
+// ALPACA_FIELDS_n expands to the binding names p1, ..., pn and
+// ALPACA_ADDRESSES_n to their addresses &p1, ..., &pn
+// built from blocks of 16 names so that no expansion is deeply nested
+#define ALPACA_FIELD_BLOCK_0 p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15, p16
+#define ALPACA_FIELD_BLOCK_1 p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31, p32
+#define ALPACA_FIELD_BLOCK_2 p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43, p44, p45, p46, p47, p48
+#define ALPACA_FIELD_BLOCK_3 p49, p50, p51, p52, p53, p54, p55, p56, p57, p58, p59, p60, p61, p62, p63, p64
+#define ALPACA_FIELD_BLOCK_4 p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76, p77, p78, p79, p80
+#define ALPACA_FIELD_BLOCK_5 p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94, p95, p96
+#define ALPACA_FIELD_BLOCK_6 p97, p98, p99, p100, p101, p102, p103, p104, p105, p106, p107, p108, p109, p110, p111, p112
+#define ALPACA_FIELD_BLOCK_7 p113, p114, p115, p116, p117, p118, p119, p120, p121, p122, p123, p124, p125, p126, p127, p128
+#define ALPACA_FIELD_BLOCK_8 p129, p130, p131, p132, p133, p134, p135, p136, p137, p138, p139, p140, p141, p142, p143, p144
+#define ALPACA_FIELD_BLOCK_9 p145, p146, p147, p148, p149, p150, p151, p152, p153, p154, p155, p156, p157, p158, p159, p160
+#define ALPACA_FIELD_BLOCK_10 p161, p162, p163, p164, p165, p166, p167, p168, p169, p170, p171, p172, p173, p174, p175, p176
+#define ALPACA_FIELD_BLOCK_11 p177, p178, p179, p180, p181, p182, p183, p184, p185, p186, p187, p188, p189, p190, p191, p192
+#define ALPACA_FIELD_BLOCK_12 p193, p194, p195, p196, p197, p198, p199, p200, p201, p202, p203, p204, p205, p206, p207, p208
+#define ALPACA_FIELD_BLOCK_13 p209, p210, p211, p212, p213, p214, p215, p216, p217, p218, p219, p220, p221, p222, p223, p224
+#define ALPACA_FIELD_BLOCK_14 p225, p226, p227, p228, p229, p230, p231, p232, p233, p234, p235, p236, p237, p238, p239, p240
+#define ALPACA_FIELD_BLOCK_15 p241, p242, p243, p244, p245, p246, p247, p248, p249, p250, p251, p252, p253, p254, p255, p256
+#define ALPACA_FIELDS_1 p1
+#define ALPACA_FIELDS_2 p1, p2
+#define ALPACA_FIELDS_3 p1, p2, p3
+#define ALPACA_FIELDS_4 p1, p2, p3, p4
+#define ALPACA_FIELDS_5 p1, p2, p3, p4, p5
+#define ALPACA_FIELDS_6 p1, p2, p3, p4, p5, p6
+#define ALPACA_FIELDS_7 p1, p2, p3, p4, p5, p6, p7
+#define ALPACA_FIELDS_8 p1, p2, p3, p4, p5, p6, p7, p8
+#define ALPACA_FIELDS_9 p1, p2, p3, p4, p5, p6, p7, p8, p9
+#define ALPACA_FIELDS_10 p1, p2, p3, p4, p5, p6, p7, p8, p9, p10
+#define ALPACA_FIELDS_11 p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11
+#define ALPACA_FIELDS_12 p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12
+#define ALPACA_FIELDS_13 p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13
+#define ALPACA_FIELDS_14 p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14
+#define ALPACA_FIELDS_15 p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15
+#define ALPACA_FIELDS_16 ALPACA_FIELD_BLOCK_0
+#define ALPACA_FIELDS_17 ALPACA_FIELD_BLOCK_0, p17
+#define ALPACA_FIELDS_18 ALPACA_FIELD_BLOCK_0, p17, p18
+#define ALPACA_FIELDS_19 ALPACA_FIELD_BLOCK_0, p17, p18, p19
+#define ALPACA_FIELDS_20 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20
+#define ALPACA_FIELDS_21 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21
+#define ALPACA_FIELDS_22 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22
+#define ALPACA_FIELDS_23 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23
+#define ALPACA_FIELDS_24 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23, p24
+#define ALPACA_FIELDS_25 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23, p24, p25
+#define ALPACA_FIELDS_26 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26
+#define ALPACA_FIELDS_27 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27
+#define ALPACA_FIELDS_28 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28
+#define ALPACA_FIELDS_29 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29
+#define ALPACA_FIELDS_30 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30
+#define ALPACA_FIELDS_31 ALPACA_FIELD_BLOCK_0, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29, p30, p31
+#define ALPACA_FIELDS_32 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1
+#define ALPACA_FIELDS_33 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33
+#define ALPACA_FIELDS_34 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34
+#define ALPACA_FIELDS_35 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35
+#define ALPACA_FIELDS_36 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36
+#define ALPACA_FIELDS_37 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37
+#define ALPACA_FIELDS_38 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38
+#define ALPACA_FIELDS_39 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39
+#define ALPACA_FIELDS_40 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39, p40
+#define ALPACA_FIELDS_41 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39, p40, p41
+#define ALPACA_FIELDS_42 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42
+#define ALPACA_FIELDS_43 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43
+#define ALPACA_FIELDS_44 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43, p44
+#define ALPACA_FIELDS_45 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43, p44, p45
+#define ALPACA_FIELDS_46 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43, p44, p45, p46
+#define ALPACA_FIELDS_47 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43, p44, p45, p46, p47
+#define ALPACA_FIELDS_48 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2
+#define ALPACA_FIELDS_49 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49
+#define ALPACA_FIELDS_50 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50
+#define ALPACA_FIELDS_51 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51
+#define ALPACA_FIELDS_52 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52
+#define ALPACA_FIELDS_53 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53
+#define ALPACA_FIELDS_54 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54
+#define ALPACA_FIELDS_55 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55
+#define ALPACA_FIELDS_56 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55, p56
+#define ALPACA_FIELDS_57 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55, p56, p57
+#define ALPACA_FIELDS_58 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55, p56, p57, p58
+#define ALPACA_FIELDS_59 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55, p56, p57, p58, p59
+#define ALPACA_FIELDS_60 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55, p56, p57, p58, p59, p60
+#define ALPACA_FIELDS_61 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55, p56, p57, p58, p59, p60, p61
+#define ALPACA_FIELDS_62 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55, p56, p57, p58, p59, p60, p61, p62
+#define ALPACA_FIELDS_63 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, p49, p50, p51, p52, p53, p54, p55, p56, p57, p58, p59, p60, p61, p62, p63
+#define ALPACA_FIELDS_64 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3
+#define ALPACA_FIELDS_65 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65
+#define ALPACA_FIELDS_66 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66
+#define ALPACA_FIELDS_67 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67
+#define ALPACA_FIELDS_68 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68
+#define ALPACA_FIELDS_69 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69
+#define ALPACA_FIELDS_70 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70
+#define ALPACA_FIELDS_71 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71
+#define ALPACA_FIELDS_72 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71, p72
+#define ALPACA_FIELDS_73 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71, p72, p73
+#define ALPACA_FIELDS_74 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74
+#define ALPACA_FIELDS_75 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75
+#define ALPACA_FIELDS_76 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76
+#define ALPACA_FIELDS_77 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76, p77
+#define ALPACA_FIELDS_78 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76, p77, p78
+#define ALPACA_FIELDS_79 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, p65, p66, p67, p68, p69, p70, p71, p72, p73, p74, p75, p76, p77, p78, p79
+#define ALPACA_FIELDS_80 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4
+#define ALPACA_FIELDS_81 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81
+#define ALPACA_FIELDS_82 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82
+#define ALPACA_FIELDS_83 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83
+#define ALPACA_FIELDS_84 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84
+#define ALPACA_FIELDS_85 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85
+#define ALPACA_FIELDS_86 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86
+#define ALPACA_FIELDS_87 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87
+#define ALPACA_FIELDS_88 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87, p88
+#define ALPACA_FIELDS_89 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87, p88, p89
+#define ALPACA_FIELDS_90 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90
+#define ALPACA_FIELDS_91 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91
+#define ALPACA_FIELDS_92 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92
+#define ALPACA_FIELDS_93 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93
+#define ALPACA_FIELDS_94 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94
+#define ALPACA_FIELDS_95 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, p81, p82, p83, p84, p85, p86, p87, p88, p89, p90, p91, p92, p93, p94, p95
+#define ALPACA_FIELDS_96 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5
+#define ALPACA_FIELDS_97 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97
+#define ALPACA_FIELDS_98 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98
+#define ALPACA_FIELDS_99 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99
+#define ALPACA_FIELDS_100 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100
+#define ALPACA_FIELDS_101 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101
+#define ALPACA_FIELDS_102 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102
+#define ALPACA_FIELDS_103 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103
+#define ALPACA_FIELDS_104 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103, p104
+#define ALPACA_FIELDS_105 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103, p104, p105
+#define ALPACA_FIELDS_106 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103, p104, p105, p106
+#define ALPACA_FIELDS_107 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103, p104, p105, p106, p107
+#define ALPACA_FIELDS_108 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103, p104, p105, p106, p107, p108
+#define ALPACA_FIELDS_109 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103, p104, p105, p106, p107, p108, p109
+#define ALPACA_FIELDS_110 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103, p104, p105, p106, p107, p108, p109, p110
+#define ALPACA_FIELDS_111 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, p97, p98, p99, p100, p101, p102, p103, p104, p105, p106, p107, p108, p109, p110, p111
+#define ALPACA_FIELDS_112 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6
+#define ALPACA_FIELDS_113 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113
+#define ALPACA_FIELDS_114 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114
+#define ALPACA_FIELDS_115 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115
+#define ALPACA_FIELDS_116 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116
+#define ALPACA_FIELDS_117 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117
+#define ALPACA_FIELDS_118 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118
+#define ALPACA_FIELDS_119 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119
+#define ALPACA_FIELDS_120 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119, p120
+#define ALPACA_FIELDS_121 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119, p120, p121
+#define ALPACA_FIELDS_122 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119, p120, p121, p122
+#define ALPACA_FIELDS_123 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119, p120, p121, p122, p123
+#define ALPACA_FIELDS_124 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119, p120, p121, p122, p123, p124
+#define ALPACA_FIELDS_125 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119, p120, p121, p122, p123, p124, p125
+#define ALPACA_FIELDS_126 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119, p120, p121, p122, p123, p124, p125, p126
+#define ALPACA_FIELDS_127 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, p113, p114, p115, p116, p117, p118, p119, p120, p121, p122, p123, p124, p125, p126, p127
+#define ALPACA_FIELDS_128 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7
+#define ALPACA_FIELDS_129 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129
+#define ALPACA_FIELDS_130 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130
+#define ALPACA_FIELDS_131 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131
+#define ALPACA_FIELDS_132 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132
+#define ALPACA_FIELDS_133 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133
+#define ALPACA_FIELDS_134 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134
+#define ALPACA_FIELDS_135 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135
+#define ALPACA_FIELDS_136 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135, p136
+#define ALPACA_FIELDS_137 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135, p136, p137
+#define ALPACA_FIELDS_138 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135, p136, p137, p138
+#define ALPACA_FIELDS_139 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135, p136, p137, p138, p139
+#define ALPACA_FIELDS_140 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135, p136, p137, p138, p139, p140
+#define ALPACA_FIELDS_141 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135, p136, p137, p138, p139, p140, p141
+#define ALPACA_FIELDS_142 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135, p136, p137, p138, p139, p140, p141, p142
+#define ALPACA_FIELDS_143 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, p129, p130, p131, p132, p133, p134, p135, p136, p137, p138, p139, p140, p141, p142, p143
+#define ALPACA_FIELDS_144 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8
+#define ALPACA_FIELDS_145 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145
+#define ALPACA_FIELDS_146 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146
+#define ALPACA_FIELDS_147 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147
+#define ALPACA_FIELDS_148 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148
+#define ALPACA_FIELDS_149 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149
+#define ALPACA_FIELDS_150 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150
+#define ALPACA_FIELDS_151 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151
+#define ALPACA_FIELDS_152 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151, p152
+#define ALPACA_FIELDS_153 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151, p152, p153
+#define ALPACA_FIELDS_154 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151, p152, p153, p154
+#define ALPACA_FIELDS_155 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151, p152, p153, p154, p155
+#define ALPACA_FIELDS_156 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151, p152, p153, p154, p155, p156
+#define ALPACA_FIELDS_157 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151, p152, p153, p154, p155, p156, p157
+#define ALPACA_FIELDS_158 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151, p152, p153, p154, p155, p156, p157, p158
+#define ALPACA_FIELDS_159 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, p145, p146, p147, p148, p149, p150, p151, p152, p153, p154, p155, p156, p157, p158, p159
+#define ALPACA_FIELDS_160 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9
+#define ALPACA_FIELDS_161 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161
+#define ALPACA_FIELDS_162 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162
+#define ALPACA_FIELDS_163 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163
+#define ALPACA_FIELDS_164 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164
+#define ALPACA_FIELDS_165 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165
+#define ALPACA_FIELDS_166 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166
+#define ALPACA_FIELDS_167 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167
+#define ALPACA_FIELDS_168 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167, p168
+#define ALPACA_FIELDS_169 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167, p168, p169
+#define ALPACA_FIELDS_170 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167, p168, p169, p170
+#define ALPACA_FIELDS_171 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167, p168, p169, p170, p171
+#define ALPACA_FIELDS_172 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167, p168, p169, p170, p171, p172
+#define ALPACA_FIELDS_173 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167, p168, p169, p170, p171, p172, p173
+#define ALPACA_FIELDS_174 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167, p168, p169, p170, p171, p172, p173, p174
+#define ALPACA_FIELDS_175 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, p161, p162, p163, p164, p165, p166, p167, p168, p169, p170, p171, p172, p173, p174, p175
+#define ALPACA_FIELDS_176 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10
+#define ALPACA_FIELDS_177 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177
+#define ALPACA_FIELDS_178 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178
+#define ALPACA_FIELDS_179 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179
+#define ALPACA_FIELDS_180 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180
+#define ALPACA_FIELDS_181 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181
+#define ALPACA_FIELDS_182 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182
+#define ALPACA_FIELDS_183 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183
+#define ALPACA_FIELDS_184 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183, p184
+#define ALPACA_FIELDS_185 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183, p184, p185
+#define ALPACA_FIELDS_186 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183, p184, p185, p186
+#define ALPACA_FIELDS_187 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183, p184, p185, p186, p187
+#define ALPACA_FIELDS_188 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183, p184, p185, p186, p187, p188
+#define ALPACA_FIELDS_189 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183, p184, p185, p186, p187, p188, p189
+#define ALPACA_FIELDS_190 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183, p184, p185, p186, p187, p188, p189, p190
+#define ALPACA_FIELDS_191 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, p177, p178, p179, p180, p181, p182, p183, p184, p185, p186, p187, p188, p189, p190, p191
+#define ALPACA_FIELDS_192 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11
+#define ALPACA_FIELDS_193 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193
+#define ALPACA_FIELDS_194 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194
+#define ALPACA_FIELDS_195 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195
+#define ALPACA_FIELDS_196 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196
+#define ALPACA_FIELDS_197 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197
+#define ALPACA_FIELDS_198 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198
+#define ALPACA_FIELDS_199 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199
+#define ALPACA_FIELDS_200 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199, p200
+#define ALPACA_FIELDS_201 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199, p200, p201
+#define ALPACA_FIELDS_202 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199, p200, p201, p202
+#define ALPACA_FIELDS_203 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199, p200, p201, p202, p203
+#define ALPACA_FIELDS_204 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199, p200, p201, p202, p203, p204
+#define ALPACA_FIELDS_205 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199, p200, p201, p202, p203, p204, p205
+#define ALPACA_FIELDS_206 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199, p200, p201, p202, p203, p204, p205, p206
+#define ALPACA_FIELDS_207 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, p193, p194, p195, p196, p197, p198, p199, p200, p201, p202, p203, p204, p205, p206, p207
+#define ALPACA_FIELDS_208 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12
+#define ALPACA_FIELDS_209 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209
+#define ALPACA_FIELDS_210 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210
+#define ALPACA_FIELDS_211 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211
+#define ALPACA_FIELDS_212 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212
+#define ALPACA_FIELDS_213 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213
+#define ALPACA_FIELDS_214 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214
+#define ALPACA_FIELDS_215 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215
+#define ALPACA_FIELDS_216 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215, p216
+#define ALPACA_FIELDS_217 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215, p216, p217
+#define ALPACA_FIELDS_218 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215, p216, p217, p218
+#define ALPACA_FIELDS_219 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215, p216, p217, p218, p219
+#define ALPACA_FIELDS_220 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215, p216, p217, p218, p219, p220
+#define ALPACA_FIELDS_221 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215, p216, p217, p218, p219, p220, p221
+#define ALPACA_FIELDS_222 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215, p216, p217, p218, p219, p220, p221, p222
+#define ALPACA_FIELDS_223 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, p209, p210, p211, p212, p213, p214, p215, p216, p217, p218, p219, p220, p221, p222, p223
+#define ALPACA_FIELDS_224 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13
+#define ALPACA_FIELDS_225 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225
+#define ALPACA_FIELDS_226 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226
+#define ALPACA_FIELDS_227 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227
+#define ALPACA_FIELDS_228 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228
+#define ALPACA_FIELDS_229 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229
+#define ALPACA_FIELDS_230 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230
+#define ALPACA_FIELDS_231 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231
+#define ALPACA_FIELDS_232 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231, p232
+#define ALPACA_FIELDS_233 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231, p232, p233
+#define ALPACA_FIELDS_234 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231, p232, p233, p234
+#define ALPACA_FIELDS_235 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231, p232, p233, p234, p235
+#define ALPACA_FIELDS_236 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231, p232, p233, p234, p235, p236
+#define ALPACA_FIELDS_237 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231, p232, p233, p234, p235, p236, p237
+#define ALPACA_FIELDS_238 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231, p232, p233, p234, p235, p236, p237, p238
+#define ALPACA_FIELDS_239 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, p225, p226, p227, p228, p229, p230, p231, p232, p233, p234, p235, p236, p237, p238, p239
+#define ALPACA_FIELDS_240 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14
+#define ALPACA_FIELDS_241 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241
+#define ALPACA_FIELDS_242 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242
+#define ALPACA_FIELDS_243 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243
+#define ALPACA_FIELDS_244 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244
+#define ALPACA_FIELDS_245 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245
+#define ALPACA_FIELDS_246 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246
+#define ALPACA_FIELDS_247 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247
+#define ALPACA_FIELDS_248 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247, p248
+#define ALPACA_FIELDS_249 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247, p248, p249
+#define ALPACA_FIELDS_250 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247, p248, p249, p250
+#define ALPACA_FIELDS_251 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247, p248, p249, p250, p251
+#define ALPACA_FIELDS_252 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247, p248, p249, p250, p251, p252
+#define ALPACA_FIELDS_253 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247, p248, p249, p250, p251, p252, p253
+#define ALPACA_FIELDS_254 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247, p248, p249, p250, p251, p252, p253, p254
+#define ALPACA_FIELDS_255 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, p241, p242, p243, p244, p245, p246, p247, p248, p249, p250, p251, p252, p253, p254, p255
+#define ALPACA_FIELDS_256 ALPACA_FIELD_BLOCK_0, ALPACA_FIELD_BLOCK_1, ALPACA_FIELD_BLOCK_2, ALPACA_FIELD_BLOCK_3, ALPACA_FIELD_BLOCK_4, ALPACA_FIELD_BLOCK_5, ALPACA_FIELD_BLOCK_6, ALPACA_FIELD_BLOCK_7, ALPACA_FIELD_BLOCK_8, ALPACA_FIELD_BLOCK_9, ALPACA_FIELD_BLOCK_10, ALPACA_FIELD_BLOCK_11, ALPACA_FIELD_BLOCK_12, ALPACA_FIELD_BLOCK_13, ALPACA_FIELD_BLOCK_14, ALPACA_FIELD_BLOCK_15
+#define ALPACA_ADDRESS_BLOCK_0 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12, &p13, &p14, &p15, &p16
+#define ALPACA_ADDRESS_BLOCK_1 &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24, &p25, &p26, &p27, &p28, &p29, &p30, &p31, &p32
+#define ALPACA_ADDRESS_BLOCK_2 &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40, &p41, &p42, &p43, &p44, &p45, &p46, &p47, &p48
+#define ALPACA_ADDRESS_BLOCK_3 &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56, &p57, &p58, &p59, &p60, &p61, &p62, &p63, &p64
+#define ALPACA_ADDRESS_BLOCK_4 &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72, &p73, &p74, &p75, &p76, &p77, &p78, &p79, &p80
+#define ALPACA_ADDRESS_BLOCK_5 &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88, &p89, &p90, &p91, &p92, &p93, &p94, &p95, &p96
+#define ALPACA_ADDRESS_BLOCK_6 &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104, &p105, &p106, &p107, &p108, &p109, &p110, &p111, &p112
+#define ALPACA_ADDRESS_BLOCK_7 &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120, &p121, &p122, &p123, &p124, &p125, &p126, &p127, &p128
+#define ALPACA_ADDRESS_BLOCK_8 &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136, &p137, &p138, &p139, &p140, &p141, &p142, &p143, &p144
+#define ALPACA_ADDRESS_BLOCK_9 &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152, &p153, &p154, &p155, &p156, &p157, &p158, &p159, &p160
+#define ALPACA_ADDRESS_BLOCK_10 &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168, &p169, &p170, &p171, &p172, &p173, &p174, &p175, &p176
+#define ALPACA_ADDRESS_BLOCK_11 &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184, &p185, &p186, &p187, &p188, &p189, &p190, &p191, &p192
+#define ALPACA_ADDRESS_BLOCK_12 &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200, &p201, &p202, &p203, &p204, &p205, &p206, &p207, &p208
+#define ALPACA_ADDRESS_BLOCK_13 &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216, &p217, &p218, &p219, &p220, &p221, &p222, &p223, &p224
+#define ALPACA_ADDRESS_BLOCK_14 &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232, &p233, &p234, &p235, &p236, &p237, &p238, &p239, &p240
+#define ALPACA_ADDRESS_BLOCK_15 &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248, &p249, &p250, &p251, &p252, &p253, &p254, &p255, &p256
+#define ALPACA_ADDRESSES_1 &p1
+#define ALPACA_ADDRESSES_2 &p1, &p2
+#define ALPACA_ADDRESSES_3 &p1, &p2, &p3
+#define ALPACA_ADDRESSES_4 &p1, &p2, &p3, &p4
+#define ALPACA_ADDRESSES_5 &p1, &p2, &p3, &p4, &p5
+#define ALPACA_ADDRESSES_6 &p1, &p2, &p3, &p4, &p5, &p6
+#define ALPACA_ADDRESSES_7 &p1, &p2, &p3, &p4, &p5, &p6, &p7
+#define ALPACA_ADDRESSES_8 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8
+#define ALPACA_ADDRESSES_9 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9
+#define ALPACA_ADDRESSES_10 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10
+#define ALPACA_ADDRESSES_11 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11
+#define ALPACA_ADDRESSES_12 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12
+#define ALPACA_ADDRESSES_13 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12, &p13
+#define ALPACA_ADDRESSES_14 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12, &p13, &p14
+#define ALPACA_ADDRESSES_15 &p1, &p2, &p3, &p4, &p5, &p6, &p7, &p8, &p9, &p10, &p11, &p12, &p13, &p14, &p15
+#define ALPACA_ADDRESSES_16 ALPACA_ADDRESS_BLOCK_0
+#define ALPACA_ADDRESSES_17 ALPACA_ADDRESS_BLOCK_0, &p17
+#define ALPACA_ADDRESSES_18 ALPACA_ADDRESS_BLOCK_0, &p17, &p18
+#define ALPACA_ADDRESSES_19 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19
+#define ALPACA_ADDRESSES_20 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20
+#define ALPACA_ADDRESSES_21 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21
+#define ALPACA_ADDRESSES_22 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22
+#define ALPACA_ADDRESSES_23 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23
+#define ALPACA_ADDRESSES_24 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24
+#define ALPACA_ADDRESSES_25 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24, &p25
+#define ALPACA_ADDRESSES_26 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24, &p25, &p26
+#define ALPACA_ADDRESSES_27 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24, &p25, &p26, &p27
+#define ALPACA_ADDRESSES_28 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24, &p25, &p26, &p27, &p28
+#define ALPACA_ADDRESSES_29 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24, &p25, &p26, &p27, &p28, &p29
+#define ALPACA_ADDRESSES_30 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24, &p25, &p26, &p27, &p28, &p29, &p30
+#define ALPACA_ADDRESSES_31 ALPACA_ADDRESS_BLOCK_0, &p17, &p18, &p19, &p20, &p21, &p22, &p23, &p24, &p25, &p26, &p27, &p28, &p29, &p30, &p31
+#define ALPACA_ADDRESSES_32 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1
+#define ALPACA_ADDRESSES_33 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33
+#define ALPACA_ADDRESSES_34 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34
+#define ALPACA_ADDRESSES_35 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35
+#define ALPACA_ADDRESSES_36 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36
+#define ALPACA_ADDRESSES_37 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37
+#define ALPACA_ADDRESSES_38 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38
+#define ALPACA_ADDRESSES_39 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39
+#define ALPACA_ADDRESSES_40 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40
+#define ALPACA_ADDRESSES_41 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40, &p41
+#define ALPACA_ADDRESSES_42 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40, &p41, &p42
+#define ALPACA_ADDRESSES_43 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40, &p41, &p42, &p43
+#define ALPACA_ADDRESSES_44 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40, &p41, &p42, &p43, &p44
+#define ALPACA_ADDRESSES_45 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40, &p41, &p42, &p43, &p44, &p45
+#define ALPACA_ADDRESSES_46 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40, &p41, &p42, &p43, &p44, &p45, &p46
+#define ALPACA_ADDRESSES_47 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, &p33, &p34, &p35, &p36, &p37, &p38, &p39, &p40, &p41, &p42, &p43, &p44, &p45, &p46, &p47
+#define ALPACA_ADDRESSES_48 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2
+#define ALPACA_ADDRESSES_49 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49
+#define ALPACA_ADDRESSES_50 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50
+#define ALPACA_ADDRESSES_51 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51
+#define ALPACA_ADDRESSES_52 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52
+#define ALPACA_ADDRESSES_53 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53
+#define ALPACA_ADDRESSES_54 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54
+#define ALPACA_ADDRESSES_55 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55
+#define ALPACA_ADDRESSES_56 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56
+#define ALPACA_ADDRESSES_57 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56, &p57
+#define ALPACA_ADDRESSES_58 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56, &p57, &p58
+#define ALPACA_ADDRESSES_59 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56, &p57, &p58, &p59
+#define ALPACA_ADDRESSES_60 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56, &p57, &p58, &p59, &p60
+#define ALPACA_ADDRESSES_61 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56, &p57, &p58, &p59, &p60, &p61
+#define ALPACA_ADDRESSES_62 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56, &p57, &p58, &p59, &p60, &p61, &p62
+#define ALPACA_ADDRESSES_63 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, &p49, &p50, &p51, &p52, &p53, &p54, &p55, &p56, &p57, &p58, &p59, &p60, &p61, &p62, &p63
+#define ALPACA_ADDRESSES_64 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3
+#define ALPACA_ADDRESSES_65 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65
+#define ALPACA_ADDRESSES_66 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66
+#define ALPACA_ADDRESSES_67 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67
+#define ALPACA_ADDRESSES_68 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68
+#define ALPACA_ADDRESSES_69 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69
+#define ALPACA_ADDRESSES_70 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70
+#define ALPACA_ADDRESSES_71 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71
+#define ALPACA_ADDRESSES_72 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72
+#define ALPACA_ADDRESSES_73 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72, &p73
+#define ALPACA_ADDRESSES_74 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72, &p73, &p74
+#define ALPACA_ADDRESSES_75 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72, &p73, &p74, &p75
+#define ALPACA_ADDRESSES_76 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72, &p73, &p74, &p75, &p76
+#define ALPACA_ADDRESSES_77 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72, &p73, &p74, &p75, &p76, &p77
+#define ALPACA_ADDRESSES_78 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72, &p73, &p74, &p75, &p76, &p77, &p78
+#define ALPACA_ADDRESSES_79 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, &p65, &p66, &p67, &p68, &p69, &p70, &p71, &p72, &p73, &p74, &p75, &p76, &p77, &p78, &p79
+#define ALPACA_ADDRESSES_80 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4
+#define ALPACA_ADDRESSES_81 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81
+#define ALPACA_ADDRESSES_82 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82
+#define ALPACA_ADDRESSES_83 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83
+#define ALPACA_ADDRESSES_84 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84
+#define ALPACA_ADDRESSES_85 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85
+#define ALPACA_ADDRESSES_86 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86
+#define ALPACA_ADDRESSES_87 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87
+#define ALPACA_ADDRESSES_88 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88
+#define ALPACA_ADDRESSES_89 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88, &p89
+#define ALPACA_ADDRESSES_90 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88, &p89, &p90
+#define ALPACA_ADDRESSES_91 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88, &p89, &p90, &p91
+#define ALPACA_ADDRESSES_92 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88, &p89, &p90, &p91, &p92
+#define ALPACA_ADDRESSES_93 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88, &p89, &p90, &p91, &p92, &p93
+#define ALPACA_ADDRESSES_94 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88, &p89, &p90, &p91, &p92, &p93, &p94
+#define ALPACA_ADDRESSES_95 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, &p81, &p82, &p83, &p84, &p85, &p86, &p87, &p88, &p89, &p90, &p91, &p92, &p93, &p94, &p95
+#define ALPACA_ADDRESSES_96 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5
+#define ALPACA_ADDRESSES_97 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97
+#define ALPACA_ADDRESSES_98 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98
+#define ALPACA_ADDRESSES_99 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99
+#define ALPACA_ADDRESSES_100 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100
+#define ALPACA_ADDRESSES_101 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101
+#define ALPACA_ADDRESSES_102 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102
+#define ALPACA_ADDRESSES_103 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103
+#define ALPACA_ADDRESSES_104 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104
+#define ALPACA_ADDRESSES_105 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104, &p105
+#define ALPACA_ADDRESSES_106 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104, &p105, &p106
+#define ALPACA_ADDRESSES_107 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104, &p105, &p106, &p107
+#define ALPACA_ADDRESSES_108 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104, &p105, &p106, &p107, &p108
+#define ALPACA_ADDRESSES_109 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104, &p105, &p106, &p107, &p108, &p109
+#define ALPACA_ADDRESSES_110 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104, &p105, &p106, &p107, &p108, &p109, &p110
+#define ALPACA_ADDRESSES_111 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, &p97, &p98, &p99, &p100, &p101, &p102, &p103, &p104, &p105, &p106, &p107, &p108, &p109, &p110, &p111
+#define ALPACA_ADDRESSES_112 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6
+#define ALPACA_ADDRESSES_113 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113
+#define ALPACA_ADDRESSES_114 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114
+#define ALPACA_ADDRESSES_115 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115
+#define ALPACA_ADDRESSES_116 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116
+#define ALPACA_ADDRESSES_117 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117
+#define ALPACA_ADDRESSES_118 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118
+#define ALPACA_ADDRESSES_119 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119
+#define ALPACA_ADDRESSES_120 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120
+#define ALPACA_ADDRESSES_121 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120, &p121
+#define ALPACA_ADDRESSES_122 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120, &p121, &p122
+#define ALPACA_ADDRESSES_123 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120, &p121, &p122, &p123
+#define ALPACA_ADDRESSES_124 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120, &p121, &p122, &p123, &p124
+#define ALPACA_ADDRESSES_125 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120, &p121, &p122, &p123, &p124, &p125
+#define ALPACA_ADDRESSES_126 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120, &p121, &p122, &p123, &p124, &p125, &p126
+#define ALPACA_ADDRESSES_127 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, &p113, &p114, &p115, &p116, &p117, &p118, &p119, &p120, &p121, &p122, &p123, &p124, &p125, &p126, &p127
+#define ALPACA_ADDRESSES_128 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7
+#define ALPACA_ADDRESSES_129 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129
+#define ALPACA_ADDRESSES_130 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130
+#define ALPACA_ADDRESSES_131 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131
+#define ALPACA_ADDRESSES_132 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132
+#define ALPACA_ADDRESSES_133 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133
+#define ALPACA_ADDRESSES_134 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134
+#define ALPACA_ADDRESSES_135 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135
+#define ALPACA_ADDRESSES_136 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136
+#define ALPACA_ADDRESSES_137 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136, &p137
+#define ALPACA_ADDRESSES_138 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136, &p137, &p138
+#define ALPACA_ADDRESSES_139 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136, &p137, &p138, &p139
+#define ALPACA_ADDRESSES_140 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136, &p137, &p138, &p139, &p140
+#define ALPACA_ADDRESSES_141 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136, &p137, &p138, &p139, &p140, &p141
+#define ALPACA_ADDRESSES_142 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136, &p137, &p138, &p139, &p140, &p141, &p142
+#define ALPACA_ADDRESSES_143 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, &p129, &p130, &p131, &p132, &p133, &p134, &p135, &p136, &p137, &p138, &p139, &p140, &p141, &p142, &p143
+#define ALPACA_ADDRESSES_144 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8
+#define ALPACA_ADDRESSES_145 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145
+#define ALPACA_ADDRESSES_146 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146
+#define ALPACA_ADDRESSES_147 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147
+#define ALPACA_ADDRESSES_148 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148
+#define ALPACA_ADDRESSES_149 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149
+#define ALPACA_ADDRESSES_150 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150
+#define ALPACA_ADDRESSES_151 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151
+#define ALPACA_ADDRESSES_152 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152
+#define ALPACA_ADDRESSES_153 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152, &p153
+#define ALPACA_ADDRESSES_154 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152, &p153, &p154
+#define ALPACA_ADDRESSES_155 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152, &p153, &p154, &p155
+#define ALPACA_ADDRESSES_156 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152, &p153, &p154, &p155, &p156
+#define ALPACA_ADDRESSES_157 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152, &p153, &p154, &p155, &p156, &p157
+#define ALPACA_ADDRESSES_158 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152, &p153, &p154, &p155, &p156, &p157, &p158
+#define ALPACA_ADDRESSES_159 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, &p145, &p146, &p147, &p148, &p149, &p150, &p151, &p152, &p153, &p154, &p155, &p156, &p157, &p158, &p159
+#define ALPACA_ADDRESSES_160 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9
+#define ALPACA_ADDRESSES_161 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161
+#define ALPACA_ADDRESSES_162 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162
+#define ALPACA_ADDRESSES_163 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163
+#define ALPACA_ADDRESSES_164 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164
+#define ALPACA_ADDRESSES_165 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165
+#define ALPACA_ADDRESSES_166 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166
+#define ALPACA_ADDRESSES_167 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167
+#define ALPACA_ADDRESSES_168 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168
+#define ALPACA_ADDRESSES_169 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168, &p169
+#define ALPACA_ADDRESSES_170 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168, &p169, &p170
+#define ALPACA_ADDRESSES_171 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168, &p169, &p170, &p171
+#define ALPACA_ADDRESSES_172 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168, &p169, &p170, &p171, &p172
+#define ALPACA_ADDRESSES_173 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168, &p169, &p170, &p171, &p172, &p173
+#define ALPACA_ADDRESSES_174 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168, &p169, &p170, &p171, &p172, &p173, &p174
+#define ALPACA_ADDRESSES_175 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, &p161, &p162, &p163, &p164, &p165, &p166, &p167, &p168, &p169, &p170, &p171, &p172, &p173, &p174, &p175
+#define ALPACA_ADDRESSES_176 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10
+#define ALPACA_ADDRESSES_177 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177
+#define ALPACA_ADDRESSES_178 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178
+#define ALPACA_ADDRESSES_179 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179
+#define ALPACA_ADDRESSES_180 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180
+#define ALPACA_ADDRESSES_181 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181
+#define ALPACA_ADDRESSES_182 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182
+#define ALPACA_ADDRESSES_183 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183
+#define ALPACA_ADDRESSES_184 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184
+#define ALPACA_ADDRESSES_185 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184, &p185
+#define ALPACA_ADDRESSES_186 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184, &p185, &p186
+#define ALPACA_ADDRESSES_187 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184, &p185, &p186, &p187
+#define ALPACA_ADDRESSES_188 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184, &p185, &p186, &p187, &p188
+#define ALPACA_ADDRESSES_189 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184, &p185, &p186, &p187, &p188, &p189
+#define ALPACA_ADDRESSES_190 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184, &p185, &p186, &p187, &p188, &p189, &p190
+#define ALPACA_ADDRESSES_191 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, &p177, &p178, &p179, &p180, &p181, &p182, &p183, &p184, &p185, &p186, &p187, &p188, &p189, &p190, &p191
+#define ALPACA_ADDRESSES_192 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11
+#define ALPACA_ADDRESSES_193 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193
+#define ALPACA_ADDRESSES_194 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194
+#define ALPACA_ADDRESSES_195 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195
+#define ALPACA_ADDRESSES_196 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196
+#define ALPACA_ADDRESSES_197 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197
+#define ALPACA_ADDRESSES_198 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198
+#define ALPACA_ADDRESSES_199 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199
+#define ALPACA_ADDRESSES_200 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200
+#define ALPACA_ADDRESSES_201 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200, &p201
+#define ALPACA_ADDRESSES_202 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200, &p201, &p202
+#define ALPACA_ADDRESSES_203 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200, &p201, &p202, &p203
+#define ALPACA_ADDRESSES_204 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200, &p201, &p202, &p203, &p204
+#define ALPACA_ADDRESSES_205 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200, &p201, &p202, &p203, &p204, &p205
+#define ALPACA_ADDRESSES_206 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200, &p201, &p202, &p203, &p204, &p205, &p206
+#define ALPACA_ADDRESSES_207 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, &p193, &p194, &p195, &p196, &p197, &p198, &p199, &p200, &p201, &p202, &p203, &p204, &p205, &p206, &p207
+#define ALPACA_ADDRESSES_208 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12
+#define ALPACA_ADDRESSES_209 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209
+#define ALPACA_ADDRESSES_210 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210
+#define ALPACA_ADDRESSES_211 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211
+#define ALPACA_ADDRESSES_212 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212
+#define ALPACA_ADDRESSES_213 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213
+#define ALPACA_ADDRESSES_214 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214
+#define ALPACA_ADDRESSES_215 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215
+#define ALPACA_ADDRESSES_216 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216
+#define ALPACA_ADDRESSES_217 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216, &p217
+#define ALPACA_ADDRESSES_218 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216, &p217, &p218
+#define ALPACA_ADDRESSES_219 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216, &p217, &p218, &p219
+#define ALPACA_ADDRESSES_220 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216, &p217, &p218, &p219, &p220
+#define ALPACA_ADDRESSES_221 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216, &p217, &p218, &p219, &p220, &p221
+#define ALPACA_ADDRESSES_222 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216, &p217, &p218, &p219, &p220, &p221, &p222
+#define ALPACA_ADDRESSES_223 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, &p209, &p210, &p211, &p212, &p213, &p214, &p215, &p216, &p217, &p218, &p219, &p220, &p221, &p222, &p223
+#define ALPACA_ADDRESSES_224 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13
+#define ALPACA_ADDRESSES_225 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225
+#define ALPACA_ADDRESSES_226 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226
+#define ALPACA_ADDRESSES_227 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227
+#define ALPACA_ADDRESSES_228 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228
+#define ALPACA_ADDRESSES_229 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229
+#define ALPACA_ADDRESSES_230 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230
+#define ALPACA_ADDRESSES_231 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231
+#define ALPACA_ADDRESSES_232 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232
+#define ALPACA_ADDRESSES_233 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232, &p233
+#define ALPACA_ADDRESSES_234 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232, &p233, &p234
+#define ALPACA_ADDRESSES_235 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232, &p233, &p234, &p235
+#define ALPACA_ADDRESSES_236 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232, &p233, &p234, &p235, &p236
+#define ALPACA_ADDRESSES_237 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232, &p233, &p234, &p235, &p236, &p237
+#define ALPACA_ADDRESSES_238 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232, &p233, &p234, &p235, &p236, &p237, &p238
+#define ALPACA_ADDRESSES_239 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, &p225, &p226, &p227, &p228, &p229, &p230, &p231, &p232, &p233, &p234, &p235, &p236, &p237, &p238, &p239
+#define ALPACA_ADDRESSES_240 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14
+#define ALPACA_ADDRESSES_241 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241
+#define ALPACA_ADDRESSES_242 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242
+#define ALPACA_ADDRESSES_243 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243
+#define ALPACA_ADDRESSES_244 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244
+#define ALPACA_ADDRESSES_245 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245
+#define ALPACA_ADDRESSES_246 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246
+#define ALPACA_ADDRESSES_247 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247
+#define ALPACA_ADDRESSES_248 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248
+#define ALPACA_ADDRESSES_249 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248, &p249
+#define ALPACA_ADDRESSES_250 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248, &p249, &p250
+#define ALPACA_ADDRESSES_251 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248, &p249, &p250, &p251
+#define ALPACA_ADDRESSES_252 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248, &p249, &p250, &p251, &p252
+#define ALPACA_ADDRESSES_253 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248, &p249, &p250, &p251, &p252, &p253
+#define ALPACA_ADDRESSES_254 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248, &p249, &p250, &p251, &p252, &p253, &p254
+#define ALPACA_ADDRESSES_255 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, &p241, &p242, &p243, &p244, &p245, &p246, &p247, &p248, &p249, &p250, &p251, &p252, &p253, &p254, &p255
+#define ALPACA_ADDRESSES_256 ALPACA_ADDRESS_BLOCK_0, ALPACA_ADDRESS_BLOCK_1, ALPACA_ADDRESS_BLOCK_2, ALPACA_ADDRESS_BLOCK_3, ALPACA_ADDRESS_BLOCK_4, ALPACA_ADDRESS_BLOCK_5, ALPACA_ADDRESS_BLOCK_6, ALPACA_ADDRESS_BLOCK_7, ALPACA_ADDRESS_BLOCK_8, ALPACA_ADDRESS_BLOCK_9, ALPACA_ADDRESS_BLOCK_10, ALPACA_ADDRESS_BLOCK_11, ALPACA_ADDRESS_BLOCK_12, ALPACA_ADDRESS_BLOCK_13, ALPACA_ADDRESS_BLOCK_14, ALPACA_ADDRESS_BLOCK_15
+
+// field_of<arity>::get<index>(value) binds the fields of an aggregate with
+// `arity` fields and returns the one at `index`
+template <std::size_t arity> struct field_of;
+
+#define ALPACA_FIELD_OF(arity)                                                 \
+  template <> struct field_of<arity> {                                         \
+    template <std::size_t index, typename type>                                \
+    ALPACA_FIELD_INLINE static constexpr decltype(auto) get(type &value)       \
+        noexcept {                                                             \
+      auto &[ALPACA_FIELDS_##arity] = value;                                   \
+      return pick_field<std::make_index_sequence<index>>::pick(                \
+          ALPACA_ADDRESSES_##arity);                                           \
+    }                                                                          \
+  };
+
+ALPACA_FIELD_OF(1)
+ALPACA_FIELD_OF(2)
+ALPACA_FIELD_OF(3)
+ALPACA_FIELD_OF(4)
+ALPACA_FIELD_OF(5)
+ALPACA_FIELD_OF(6)
+ALPACA_FIELD_OF(7)
+ALPACA_FIELD_OF(8)
+ALPACA_FIELD_OF(9)
+ALPACA_FIELD_OF(10)
+ALPACA_FIELD_OF(11)
+ALPACA_FIELD_OF(12)
+ALPACA_FIELD_OF(13)
+ALPACA_FIELD_OF(14)
+ALPACA_FIELD_OF(15)
+ALPACA_FIELD_OF(16)
+ALPACA_FIELD_OF(17)
+ALPACA_FIELD_OF(18)
+ALPACA_FIELD_OF(19)
+ALPACA_FIELD_OF(20)
+ALPACA_FIELD_OF(21)
+ALPACA_FIELD_OF(22)
+ALPACA_FIELD_OF(23)
+ALPACA_FIELD_OF(24)
+ALPACA_FIELD_OF(25)
+ALPACA_FIELD_OF(26)
+ALPACA_FIELD_OF(27)
+ALPACA_FIELD_OF(28)
+ALPACA_FIELD_OF(29)
+ALPACA_FIELD_OF(30)
+ALPACA_FIELD_OF(31)
+ALPACA_FIELD_OF(32)
+ALPACA_FIELD_OF(33)
+ALPACA_FIELD_OF(34)
+ALPACA_FIELD_OF(35)
+ALPACA_FIELD_OF(36)
+ALPACA_FIELD_OF(37)
+ALPACA_FIELD_OF(38)
+ALPACA_FIELD_OF(39)
+ALPACA_FIELD_OF(40)
+ALPACA_FIELD_OF(41)
+ALPACA_FIELD_OF(42)
+ALPACA_FIELD_OF(43)
+ALPACA_FIELD_OF(44)
+ALPACA_FIELD_OF(45)
+ALPACA_FIELD_OF(46)
+ALPACA_FIELD_OF(47)
+ALPACA_FIELD_OF(48)
+ALPACA_FIELD_OF(49)
+ALPACA_FIELD_OF(50)
+ALPACA_FIELD_OF(51)
+ALPACA_FIELD_OF(52)
+ALPACA_FIELD_OF(53)
+ALPACA_FIELD_OF(54)
+ALPACA_FIELD_OF(55)
+ALPACA_FIELD_OF(56)
+ALPACA_FIELD_OF(57)
+ALPACA_FIELD_OF(58)
+ALPACA_FIELD_OF(59)
+ALPACA_FIELD_OF(60)
+ALPACA_FIELD_OF(61)
+ALPACA_FIELD_OF(62)
+ALPACA_FIELD_OF(63)
+ALPACA_FIELD_OF(64)
+ALPACA_FIELD_OF(65)
+ALPACA_FIELD_OF(66)
+ALPACA_FIELD_OF(67)
+ALPACA_FIELD_OF(68)
+ALPACA_FIELD_OF(69)
+ALPACA_FIELD_OF(70)
+ALPACA_FIELD_OF(71)
+ALPACA_FIELD_OF(72)
+ALPACA_FIELD_OF(73)
+ALPACA_FIELD_OF(74)
+ALPACA_FIELD_OF(75)
+ALPACA_FIELD_OF(76)
+ALPACA_FIELD_OF(77)
+ALPACA_FIELD_OF(78)
+ALPACA_FIELD_OF(79)
+ALPACA_FIELD_OF(80)
+ALPACA_FIELD_OF(81)
+ALPACA_FIELD_OF(82)
+ALPACA_FIELD_OF(83)
+ALPACA_FIELD_OF(84)
+ALPACA_FIELD_OF(85)
+ALPACA_FIELD_OF(86)
+ALPACA_FIELD_OF(87)
+ALPACA_FIELD_OF(88)
+ALPACA_FIELD_OF(89)
+ALPACA_FIELD_OF(90)
+ALPACA_FIELD_OF(91)
+ALPACA_FIELD_OF(92)
+ALPACA_FIELD_OF(93)
+ALPACA_FIELD_OF(94)
+ALPACA_FIELD_OF(95)
+ALPACA_FIELD_OF(96)
+ALPACA_FIELD_OF(97)
+ALPACA_FIELD_OF(98)
+ALPACA_FIELD_OF(99)
+ALPACA_FIELD_OF(100)
+ALPACA_FIELD_OF(101)
+ALPACA_FIELD_OF(102)
+ALPACA_FIELD_OF(103)
+ALPACA_FIELD_OF(104)
+ALPACA_FIELD_OF(105)
+ALPACA_FIELD_OF(106)
+ALPACA_FIELD_OF(107)
+ALPACA_FIELD_OF(108)
+ALPACA_FIELD_OF(109)
+ALPACA_FIELD_OF(110)
+ALPACA_FIELD_OF(111)
+ALPACA_FIELD_OF(112)
+ALPACA_FIELD_OF(113)
+ALPACA_FIELD_OF(114)
+ALPACA_FIELD_OF(115)
+ALPACA_FIELD_OF(116)
+ALPACA_FIELD_OF(117)
+ALPACA_FIELD_OF(118)
+ALPACA_FIELD_OF(119)
+ALPACA_FIELD_OF(120)
+ALPACA_FIELD_OF(121)
+ALPACA_FIELD_OF(122)
+ALPACA_FIELD_OF(123)
+ALPACA_FIELD_OF(124)
+ALPACA_FIELD_OF(125)
+ALPACA_FIELD_OF(126)
+ALPACA_FIELD_OF(127)
+ALPACA_FIELD_OF(128)
+ALPACA_FIELD_OF(129)
+ALPACA_FIELD_OF(130)
+ALPACA_FIELD_OF(131)
+ALPACA_FIELD_OF(132)
+ALPACA_FIELD_OF(133)
+ALPACA_FIELD_OF(134)
+ALPACA_FIELD_OF(135)
+ALPACA_FIELD_OF(136)
+ALPACA_FIELD_OF(137)
+ALPACA_FIELD_OF(138)
+ALPACA_FIELD_OF(139)
+ALPACA_FIELD_OF(140)
+ALPACA_FIELD_OF(141)
+ALPACA_FIELD_OF(142)
+ALPACA_FIELD_OF(143)
+ALPACA_FIELD_OF(144)
+ALPACA_FIELD_OF(145)
+ALPACA_FIELD_OF(146)
+ALPACA_FIELD_OF(147)
+ALPACA_FIELD_OF(148)
+ALPACA_FIELD_OF(149)
+ALPACA_FIELD_OF(150)
+ALPACA_FIELD_OF(151)
+ALPACA_FIELD_OF(152)
+ALPACA_FIELD_OF(153)
+ALPACA_FIELD_OF(154)
+ALPACA_FIELD_OF(155)
+ALPACA_FIELD_OF(156)
+ALPACA_FIELD_OF(157)
+ALPACA_FIELD_OF(158)
+ALPACA_FIELD_OF(159)
+ALPACA_FIELD_OF(160)
+ALPACA_FIELD_OF(161)
+ALPACA_FIELD_OF(162)
+ALPACA_FIELD_OF(163)
+ALPACA_FIELD_OF(164)
+ALPACA_FIELD_OF(165)
+ALPACA_FIELD_OF(166)
+ALPACA_FIELD_OF(167)
+ALPACA_FIELD_OF(168)
+ALPACA_FIELD_OF(169)
+ALPACA_FIELD_OF(170)
+ALPACA_FIELD_OF(171)
+ALPACA_FIELD_OF(172)
+ALPACA_FIELD_OF(173)
+ALPACA_FIELD_OF(174)
+ALPACA_FIELD_OF(175)
+ALPACA_FIELD_OF(176)
+ALPACA_FIELD_OF(177)
+ALPACA_FIELD_OF(178)
+ALPACA_FIELD_OF(179)
+ALPACA_FIELD_OF(180)
+ALPACA_FIELD_OF(181)
+ALPACA_FIELD_OF(182)
+ALPACA_FIELD_OF(183)
+ALPACA_FIELD_OF(184)
+ALPACA_FIELD_OF(185)
+ALPACA_FIELD_OF(186)
+ALPACA_FIELD_OF(187)
+ALPACA_FIELD_OF(188)
+ALPACA_FIELD_OF(189)
+ALPACA_FIELD_OF(190)
+ALPACA_FIELD_OF(191)
+ALPACA_FIELD_OF(192)
+ALPACA_FIELD_OF(193)
+ALPACA_FIELD_OF(194)
+ALPACA_FIELD_OF(195)
+ALPACA_FIELD_OF(196)
+ALPACA_FIELD_OF(197)
+ALPACA_FIELD_OF(198)
+ALPACA_FIELD_OF(199)
+ALPACA_FIELD_OF(200)
+ALPACA_FIELD_OF(201)
+ALPACA_FIELD_OF(202)
+ALPACA_FIELD_OF(203)
+ALPACA_FIELD_OF(204)
+ALPACA_FIELD_OF(205)
+ALPACA_FIELD_OF(206)
+ALPACA_FIELD_OF(207)
+ALPACA_FIELD_OF(208)
+ALPACA_FIELD_OF(209)
+ALPACA_FIELD_OF(210)
+ALPACA_FIELD_OF(211)
+ALPACA_FIELD_OF(212)
+ALPACA_FIELD_OF(213)
+ALPACA_FIELD_OF(214)
+ALPACA_FIELD_OF(215)
+ALPACA_FIELD_OF(216)
+ALPACA_FIELD_OF(217)
+ALPACA_FIELD_OF(218)
+ALPACA_FIELD_OF(219)
+ALPACA_FIELD_OF(220)
+ALPACA_FIELD_OF(221)
+ALPACA_FIELD_OF(222)
+ALPACA_FIELD_OF(223)
+ALPACA_FIELD_OF(224)
+ALPACA_FIELD_OF(225)
+ALPACA_FIELD_OF(226)
+ALPACA_FIELD_OF(227)
+ALPACA_FIELD_OF(228)
+ALPACA_FIELD_OF(229)
+ALPACA_FIELD_OF(230)
+ALPACA_FIELD_OF(231)
+ALPACA_FIELD_OF(232)
+ALPACA_FIELD_OF(233)
+ALPACA_FIELD_OF(234)
+ALPACA_FIELD_OF(235)
+ALPACA_FIELD_OF(236)
+ALPACA_FIELD_OF(237)
+ALPACA_FIELD_OF(238)
+ALPACA_FIELD_OF(239)
+ALPACA_FIELD_OF(240)
+ALPACA_FIELD_OF(241)
+ALPACA_FIELD_OF(242)
+ALPACA_FIELD_OF(243)
+ALPACA_FIELD_OF(244)
+ALPACA_FIELD_OF(245)
+ALPACA_FIELD_OF(246)
+ALPACA_FIELD_OF(247)
+ALPACA_FIELD_OF(248)
+ALPACA_FIELD_OF(249)
+ALPACA_FIELD_OF(250)
+ALPACA_FIELD_OF(251)
+ALPACA_FIELD_OF(252)
+ALPACA_FIELD_OF(253)
+ALPACA_FIELD_OF(254)
+ALPACA_FIELD_OF(255)
+ALPACA_FIELD_OF(256)
+
+#undef ALPACA_FIELD_OF
+#undef ALPACA_FIELD_INLINE
+#undef ALPACA_FIELDS_1
+#undef ALPACA_FIELDS_2
+#undef ALPACA_FIELDS_3
+#undef ALPACA_FIELDS_4
+#undef ALPACA_FIELDS_5
+#undef ALPACA_FIELDS_6
+#undef ALPACA_FIELDS_7
+#undef ALPACA_FIELDS_8
+#undef ALPACA_FIELDS_9
+#undef ALPACA_FIELDS_10
+#undef ALPACA_FIELDS_11
+#undef ALPACA_FIELDS_12
+#undef ALPACA_FIELDS_13
+#undef ALPACA_FIELDS_14
+#undef ALPACA_FIELDS_15
+#undef ALPACA_FIELDS_16
+#undef ALPACA_FIELDS_17
+#undef ALPACA_FIELDS_18
+#undef ALPACA_FIELDS_19
+#undef ALPACA_FIELDS_20
+#undef ALPACA_FIELDS_21
+#undef ALPACA_FIELDS_22
+#undef ALPACA_FIELDS_23
+#undef ALPACA_FIELDS_24
+#undef ALPACA_FIELDS_25
+#undef ALPACA_FIELDS_26
+#undef ALPACA_FIELDS_27
+#undef ALPACA_FIELDS_28
+#undef ALPACA_FIELDS_29
+#undef ALPACA_FIELDS_30
+#undef ALPACA_FIELDS_31
+#undef ALPACA_FIELDS_32
+#undef ALPACA_FIELDS_33
+#undef ALPACA_FIELDS_34
+#undef ALPACA_FIELDS_35
+#undef ALPACA_FIELDS_36
+#undef ALPACA_FIELDS_37
+#undef ALPACA_FIELDS_38
+#undef ALPACA_FIELDS_39
+#undef ALPACA_FIELDS_40
+#undef ALPACA_FIELDS_41
+#undef ALPACA_FIELDS_42
+#undef ALPACA_FIELDS_43
+#undef ALPACA_FIELDS_44
+#undef ALPACA_FIELDS_45
+#undef ALPACA_FIELDS_46
+#undef ALPACA_FIELDS_47
+#undef ALPACA_FIELDS_48
+#undef ALPACA_FIELDS_49
+#undef ALPACA_FIELDS_50
+#undef ALPACA_FIELDS_51
+#undef ALPACA_FIELDS_52
+#undef ALPACA_FIELDS_53
+#undef ALPACA_FIELDS_54
+#undef ALPACA_FIELDS_55
+#undef ALPACA_FIELDS_56
+#undef ALPACA_FIELDS_57
+#undef ALPACA_FIELDS_58
+#undef ALPACA_FIELDS_59
+#undef ALPACA_FIELDS_60
+#undef ALPACA_FIELDS_61
+#undef ALPACA_FIELDS_62
+#undef ALPACA_FIELDS_63
+#undef ALPACA_FIELDS_64
+#undef ALPACA_FIELDS_65
+#undef ALPACA_FIELDS_66
+#undef ALPACA_FIELDS_67
+#undef ALPACA_FIELDS_68
+#undef ALPACA_FIELDS_69
+#undef ALPACA_FIELDS_70
+#undef ALPACA_FIELDS_71
+#undef ALPACA_FIELDS_72
+#undef ALPACA_FIELDS_73
+#undef ALPACA_FIELDS_74
+#undef ALPACA_FIELDS_75
+#undef ALPACA_FIELDS_76
+#undef ALPACA_FIELDS_77
+#undef ALPACA_FIELDS_78
+#undef ALPACA_FIELDS_79
+#undef ALPACA_FIELDS_80
+#undef ALPACA_FIELDS_81
+#undef ALPACA_FIELDS_82
+#undef ALPACA_FIELDS_83
+#undef ALPACA_FIELDS_84
+#undef ALPACA_FIELDS_85
+#undef ALPACA_FIELDS_86
+#undef ALPACA_FIELDS_87
+#undef ALPACA_FIELDS_88
+#undef ALPACA_FIELDS_89
+#undef ALPACA_FIELDS_90
+#undef ALPACA_FIELDS_91
+#undef ALPACA_FIELDS_92
+#undef ALPACA_FIELDS_93
+#undef ALPACA_FIELDS_94
+#undef ALPACA_FIELDS_95
+#undef ALPACA_FIELDS_96
+#undef ALPACA_FIELDS_97
+#undef ALPACA_FIELDS_98
+#undef ALPACA_FIELDS_99
+#undef ALPACA_FIELDS_100
+#undef ALPACA_FIELDS_101
+#undef ALPACA_FIELDS_102
+#undef ALPACA_FIELDS_103
+#undef ALPACA_FIELDS_104
+#undef ALPACA_FIELDS_105
+#undef ALPACA_FIELDS_106
+#undef ALPACA_FIELDS_107
+#undef ALPACA_FIELDS_108
+#undef ALPACA_FIELDS_109
+#undef ALPACA_FIELDS_110
+#undef ALPACA_FIELDS_111
+#undef ALPACA_FIELDS_112
+#undef ALPACA_FIELDS_113
+#undef ALPACA_FIELDS_114
+#undef ALPACA_FIELDS_115
+#undef ALPACA_FIELDS_116
+#undef ALPACA_FIELDS_117
+#undef ALPACA_FIELDS_118
+#undef ALPACA_FIELDS_119
+#undef ALPACA_FIELDS_120
+#undef ALPACA_FIELDS_121
+#undef ALPACA_FIELDS_122
+#undef ALPACA_FIELDS_123
+#undef ALPACA_FIELDS_124
+#undef ALPACA_FIELDS_125
+#undef ALPACA_FIELDS_126
+#undef ALPACA_FIELDS_127
+#undef ALPACA_FIELDS_128
+#undef ALPACA_FIELDS_129
+#undef ALPACA_FIELDS_130
+#undef ALPACA_FIELDS_131
+#undef ALPACA_FIELDS_132
+#undef ALPACA_FIELDS_133
+#undef ALPACA_FIELDS_134
+#undef ALPACA_FIELDS_135
+#undef ALPACA_FIELDS_136
+#undef ALPACA_FIELDS_137
+#undef ALPACA_FIELDS_138
+#undef ALPACA_FIELDS_139
+#undef ALPACA_FIELDS_140
+#undef ALPACA_FIELDS_141
+#undef ALPACA_FIELDS_142
+#undef ALPACA_FIELDS_143
+#undef ALPACA_FIELDS_144
+#undef ALPACA_FIELDS_145
+#undef ALPACA_FIELDS_146
+#undef ALPACA_FIELDS_147
+#undef ALPACA_FIELDS_148
+#undef ALPACA_FIELDS_149
+#undef ALPACA_FIELDS_150
+#undef ALPACA_FIELDS_151
+#undef ALPACA_FIELDS_152
+#undef ALPACA_FIELDS_153
+#undef ALPACA_FIELDS_154
+#undef ALPACA_FIELDS_155
+#undef ALPACA_FIELDS_156
+#undef ALPACA_FIELDS_157
+#undef ALPACA_FIELDS_158
+#undef ALPACA_FIELDS_159
+#undef ALPACA_FIELDS_160
+#undef ALPACA_FIELDS_161
+#undef ALPACA_FIELDS_162
+#undef ALPACA_FIELDS_163
+#undef ALPACA_FIELDS_164
+#undef ALPACA_FIELDS_165
+#undef ALPACA_FIELDS_166
+#undef ALPACA_FIELDS_167
+#undef ALPACA_FIELDS_168
+#undef ALPACA_FIELDS_169
+#undef ALPACA_FIELDS_170
+#undef ALPACA_FIELDS_171
+#undef ALPACA_FIELDS_172
+#undef ALPACA_FIELDS_173
+#undef ALPACA_FIELDS_174
+#undef ALPACA_FIELDS_175
+#undef ALPACA_FIELDS_176
+#undef ALPACA_FIELDS_177
+#undef ALPACA_FIELDS_178
+#undef ALPACA_FIELDS_179
+#undef ALPACA_FIELDS_180
+#undef ALPACA_FIELDS_181
+#undef ALPACA_FIELDS_182
+#undef ALPACA_FIELDS_183
+#undef ALPACA_FIELDS_184
+#undef ALPACA_FIELDS_185
+#undef ALPACA_FIELDS_186
+#undef ALPACA_FIELDS_187
+#undef ALPACA_FIELDS_188
+#undef ALPACA_FIELDS_189
+#undef ALPACA_FIELDS_190
+#undef ALPACA_FIELDS_191
+#undef ALPACA_FIELDS_192
+#undef ALPACA_FIELDS_193
+#undef ALPACA_FIELDS_194
+#undef ALPACA_FIELDS_195
+#undef ALPACA_FIELDS_196
+#undef ALPACA_FIELDS_197
+#undef ALPACA_FIELDS_198
+#undef ALPACA_FIELDS_199
+#undef ALPACA_FIELDS_200
+#undef ALPACA_FIELDS_201
+#undef ALPACA_FIELDS_202
+#undef ALPACA_FIELDS_203
+#undef ALPACA_FIELDS_204
+#undef ALPACA_FIELDS_205
+#undef ALPACA_FIELDS_206
+#undef ALPACA_FIELDS_207
+#undef ALPACA_FIELDS_208
+#undef ALPACA_FIELDS_209
+#undef ALPACA_FIELDS_210
+#undef ALPACA_FIELDS_211
+#undef ALPACA_FIELDS_212
+#undef ALPACA_FIELDS_213
+#undef ALPACA_FIELDS_214
+#undef ALPACA_FIELDS_215
+#undef ALPACA_FIELDS_216
+#undef ALPACA_FIELDS_217
+#undef ALPACA_FIELDS_218
+#undef ALPACA_FIELDS_219
+#undef ALPACA_FIELDS_220
+#undef ALPACA_FIELDS_221
+#undef ALPACA_FIELDS_222
+#undef ALPACA_FIELDS_223
+#undef ALPACA_FIELDS_224
+#undef ALPACA_FIELDS_225
+#undef ALPACA_FIELDS_226
+#undef ALPACA_FIELDS_227
+#undef ALPACA_FIELDS_228
+#undef ALPACA_FIELDS_229
+#undef ALPACA_FIELDS_230
+#undef ALPACA_FIELDS_231
+#undef ALPACA_FIELDS_232
+#undef ALPACA_FIELDS_233
+#undef ALPACA_FIELDS_234
+#undef ALPACA_FIELDS_235
+#undef ALPACA_FIELDS_236
+#undef ALPACA_FIELDS_237
+#undef ALPACA_FIELDS_238
+#undef ALPACA_FIELDS_239
+#undef ALPACA_FIELDS_240
+#undef ALPACA_FIELDS_241
+#undef ALPACA_FIELDS_242
+#undef ALPACA_FIELDS_243
+#undef ALPACA_FIELDS_244
+#undef ALPACA_FIELDS_245
+#undef ALPACA_FIELDS_246
+#undef ALPACA_FIELDS_247
+#undef ALPACA_FIELDS_248
+#undef ALPACA_FIELDS_249
+#undef ALPACA_FIELDS_250
+#undef ALPACA_FIELDS_251
+#undef ALPACA_FIELDS_252
+#undef ALPACA_FIELDS_253
+#undef ALPACA_FIELDS_254
+#undef ALPACA_FIELDS_255
+#undef ALPACA_FIELDS_256
+#undef ALPACA_ADDRESSES_1
+#undef ALPACA_ADDRESSES_2
+#undef ALPACA_ADDRESSES_3
+#undef ALPACA_ADDRESSES_4
+#undef ALPACA_ADDRESSES_5
+#undef ALPACA_ADDRESSES_6
+#undef ALPACA_ADDRESSES_7
+#undef ALPACA_ADDRESSES_8
+#undef ALPACA_ADDRESSES_9
+#undef ALPACA_ADDRESSES_10
+#undef ALPACA_ADDRESSES_11
+#undef ALPACA_ADDRESSES_12
+#undef ALPACA_ADDRESSES_13
+#undef ALPACA_ADDRESSES_14
+#undef ALPACA_ADDRESSES_15
+#undef ALPACA_ADDRESSES_16
+#undef ALPACA_ADDRESSES_17
+#undef ALPACA_ADDRESSES_18
+#undef ALPACA_ADDRESSES_19
+#undef ALPACA_ADDRESSES_20
+#undef ALPACA_ADDRESSES_21
+#undef ALPACA_ADDRESSES_22
+#undef ALPACA_ADDRESSES_23
+#undef ALPACA_ADDRESSES_24
+#undef ALPACA_ADDRESSES_25
+#undef ALPACA_ADDRESSES_26
+#undef ALPACA_ADDRESSES_27
+#undef ALPACA_ADDRESSES_28
+#undef ALPACA_ADDRESSES_29
+#undef ALPACA_ADDRESSES_30
+#undef ALPACA_ADDRESSES_31
+#undef ALPACA_ADDRESSES_32
+#undef ALPACA_ADDRESSES_33
+#undef ALPACA_ADDRESSES_34
+#undef ALPACA_ADDRESSES_35
+#undef ALPACA_ADDRESSES_36
+#undef ALPACA_ADDRESSES_37
+#undef ALPACA_ADDRESSES_38
+#undef ALPACA_ADDRESSES_39
+#undef ALPACA_ADDRESSES_40
+#undef ALPACA_ADDRESSES_41
+#undef ALPACA_ADDRESSES_42
+#undef ALPACA_ADDRESSES_43
+#undef ALPACA_ADDRESSES_44
+#undef ALPACA_ADDRESSES_45
+#undef ALPACA_ADDRESSES_46
+#undef ALPACA_ADDRESSES_47
+#undef ALPACA_ADDRESSES_48
+#undef ALPACA_ADDRESSES_49
+#undef ALPACA_ADDRESSES_50
+#undef ALPACA_ADDRESSES_51
+#undef ALPACA_ADDRESSES_52
+#undef ALPACA_ADDRESSES_53
+#undef ALPACA_ADDRESSES_54
+#undef ALPACA_ADDRESSES_55
+#undef ALPACA_ADDRESSES_56
+#undef ALPACA_ADDRESSES_57
+#undef ALPACA_ADDRESSES_58
+#undef ALPACA_ADDRESSES_59
+#undef ALPACA_ADDRESSES_60
+#undef ALPACA_ADDRESSES_61
+#undef ALPACA_ADDRESSES_62
+#undef ALPACA_ADDRESSES_63
+#undef ALPACA_ADDRESSES_64
+#undef ALPACA_ADDRESSES_65
+#undef ALPACA_ADDRESSES_66
+#undef ALPACA_ADDRESSES_67
+#undef ALPACA_ADDRESSES_68
+#undef ALPACA_ADDRESSES_69
+#undef ALPACA_ADDRESSES_70
+#undef ALPACA_ADDRESSES_71
+#undef ALPACA_ADDRESSES_72
+#undef ALPACA_ADDRESSES_73
+#undef ALPACA_ADDRESSES_74
+#undef ALPACA_ADDRESSES_75
+#undef ALPACA_ADDRESSES_76
+#undef ALPACA_ADDRESSES_77
+#undef ALPACA_ADDRESSES_78
+#undef ALPACA_ADDRESSES_79
+#undef ALPACA_ADDRESSES_80
+#undef ALPACA_ADDRESSES_81
+#undef ALPACA_ADDRESSES_82
+#undef ALPACA_ADDRESSES_83
+#undef ALPACA_ADDRESSES_84
+#undef ALPACA_ADDRESSES_85
+#undef ALPACA_ADDRESSES_86
+#undef ALPACA_ADDRESSES_87
+#undef ALPACA_ADDRESSES_88
+#undef ALPACA_ADDRESSES_89
+#undef ALPACA_ADDRESSES_90
+#undef ALPACA_ADDRESSES_91
+#undef ALPACA_ADDRESSES_92
+#undef ALPACA_ADDRESSES_93
+#undef ALPACA_ADDRESSES_94
+#undef ALPACA_ADDRESSES_95
+#undef ALPACA_ADDRESSES_96
+#undef ALPACA_ADDRESSES_97
+#undef ALPACA_ADDRESSES_98
+#undef ALPACA_ADDRESSES_99
+#undef ALPACA_ADDRESSES_100
+#undef ALPACA_ADDRESSES_101
+#undef ALPACA_ADDRESSES_102
+#undef ALPACA_ADDRESSES_103
+#undef ALPACA_ADDRESSES_104
+#undef ALPACA_ADDRESSES_105
+#undef ALPACA_ADDRESSES_106
+#undef ALPACA_ADDRESSES_107
+#undef ALPACA_ADDRESSES_108
+#undef ALPACA_ADDRESSES_109
+#undef ALPACA_ADDRESSES_110
+#undef ALPACA_ADDRESSES_111
+#undef ALPACA_ADDRESSES_112
+#undef ALPACA_ADDRESSES_113
+#undef ALPACA_ADDRESSES_114
+#undef ALPACA_ADDRESSES_115
+#undef ALPACA_ADDRESSES_116
+#undef ALPACA_ADDRESSES_117
+#undef ALPACA_ADDRESSES_118
+#undef ALPACA_ADDRESSES_119
+#undef ALPACA_ADDRESSES_120
+#undef ALPACA_ADDRESSES_121
+#undef ALPACA_ADDRESSES_122
+#undef ALPACA_ADDRESSES_123
+#undef ALPACA_ADDRESSES_124
+#undef ALPACA_ADDRESSES_125
+#undef ALPACA_ADDRESSES_126
+#undef ALPACA_ADDRESSES_127
+#undef ALPACA_ADDRESSES_128
+#undef ALPACA_ADDRESSES_129
+#undef ALPACA_ADDRESSES_130
+#undef ALPACA_ADDRESSES_131
+#undef ALPACA_ADDRESSES_132
+#undef ALPACA_ADDRESSES_133
+#undef ALPACA_ADDRESSES_134
+#undef ALPACA_ADDRESSES_135
+#undef ALPACA_ADDRESSES_136
+#undef ALPACA_ADDRESSES_137
+#undef ALPACA_ADDRESSES_138
+#undef ALPACA_ADDRESSES_139
+#undef ALPACA_ADDRESSES_140
+#undef ALPACA_ADDRESSES_141
+#undef ALPACA_ADDRESSES_142
+#undef ALPACA_ADDRESSES_143
+#undef ALPACA_ADDRESSES_144
+#undef ALPACA_ADDRESSES_145
+#undef ALPACA_ADDRESSES_146
+#undef ALPACA_ADDRESSES_147
+#undef ALPACA_ADDRESSES_148
+#undef ALPACA_ADDRESSES_149
+#undef ALPACA_ADDRESSES_150
+#undef ALPACA_ADDRESSES_151
+#undef ALPACA_ADDRESSES_152
+#undef ALPACA_ADDRESSES_153
+#undef ALPACA_ADDRESSES_154
+#undef ALPACA_ADDRESSES_155
+#undef ALPACA_ADDRESSES_156
+#undef ALPACA_ADDRESSES_157
+#undef ALPACA_ADDRESSES_158
+#undef ALPACA_ADDRESSES_159
+#undef ALPACA_ADDRESSES_160
+#undef ALPACA_ADDRESSES_161
+#undef ALPACA_ADDRESSES_162
+#undef ALPACA_ADDRESSES_163
+#undef ALPACA_ADDRESSES_164
+#undef ALPACA_ADDRESSES_165
+#undef ALPACA_ADDRESSES_166
+#undef ALPACA_ADDRESSES_167
+#undef ALPACA_ADDRESSES_168
+#undef ALPACA_ADDRESSES_169
+#undef ALPACA_ADDRESSES_170
+#undef ALPACA_ADDRESSES_171
+#undef ALPACA_ADDRESSES_172
+#undef ALPACA_ADDRESSES_173
+#undef ALPACA_ADDRESSES_174
+#undef ALPACA_ADDRESSES_175
+#undef ALPACA_ADDRESSES_176
+#undef ALPACA_ADDRESSES_177
+#undef ALPACA_ADDRESSES_178
+#undef ALPACA_ADDRESSES_179
+#undef ALPACA_ADDRESSES_180
+#undef ALPACA_ADDRESSES_181
+#undef ALPACA_ADDRESSES_182
+#undef ALPACA_ADDRESSES_183
+#undef ALPACA_ADDRESSES_184
+#undef ALPACA_ADDRESSES_185
+#undef ALPACA_ADDRESSES_186
+#undef ALPACA_ADDRESSES_187
+#undef ALPACA_ADDRESSES_188
+#undef ALPACA_ADDRESSES_189
+#undef ALPACA_ADDRESSES_190
+#undef ALPACA_ADDRESSES_191
+#undef ALPACA_ADDRESSES_192
+#undef ALPACA_ADDRESSES_193
+#undef ALPACA_ADDRESSES_194
+#undef ALPACA_ADDRESSES_195
+#undef ALPACA_ADDRESSES_196
+#undef ALPACA_ADDRESSES_197
+#undef ALPACA_ADDRESSES_198
+#undef ALPACA_ADDRESSES_199
+#undef ALPACA_ADDRESSES_200
+#undef ALPACA_ADDRESSES_201
+#undef ALPACA_ADDRESSES_202
+#undef ALPACA_ADDRESSES_203
+#undef ALPACA_ADDRESSES_204
+#undef ALPACA_ADDRESSES_205
+#undef ALPACA_ADDRESSES_206
+#undef ALPACA_ADDRESSES_207
+#undef ALPACA_ADDRESSES_208
+#undef ALPACA_ADDRESSES_209
+#undef ALPACA_ADDRESSES_210
+#undef ALPACA_ADDRESSES_211
+#undef ALPACA_ADDRESSES_212
+#undef ALPACA_ADDRESSES_213
+#undef ALPACA_ADDRESSES_214
+#undef ALPACA_ADDRESSES_215
+#undef ALPACA_ADDRESSES_216
+#undef ALPACA_ADDRESSES_217
+#undef ALPACA_ADDRESSES_218
+#undef ALPACA_ADDRESSES_219
+#undef ALPACA_ADDRESSES_220
+#undef ALPACA_ADDRESSES_221
+#undef ALPACA_ADDRESSES_222
+#undef ALPACA_ADDRESSES_223
+#undef ALPACA_ADDRESSES_224
+#undef ALPACA_ADDRESSES_225
+#undef ALPACA_ADDRESSES_226
+#undef ALPACA_ADDRESSES_227
+#undef ALPACA_ADDRESSES_228
+#undef ALPACA_ADDRESSES_229
+#undef ALPACA_ADDRESSES_230
+#undef ALPACA_ADDRESSES_231
+#undef ALPACA_ADDRESSES_232
+#undef ALPACA_ADDRESSES_233
+#undef ALPACA_ADDRESSES_234
+#undef ALPACA_ADDRESSES_235
+#undef ALPACA_ADDRESSES_236
+#undef ALPACA_ADDRESSES_237
+#undef ALPACA_ADDRESSES_238
+#undef ALPACA_ADDRESSES_239
+#undef ALPACA_ADDRESSES_240
+#undef ALPACA_ADDRESSES_241
+#undef ALPACA_ADDRESSES_242
+#undef ALPACA_ADDRESSES_243
+#undef ALPACA_ADDRESSES_244
+#undef ALPACA_ADDRESSES_245
+#undef ALPACA_ADDRESSES_246
+#undef ALPACA_ADDRESSES_247
+#undef ALPACA_ADDRESSES_248
+#undef ALPACA_ADDRESSES_249
+#undef ALPACA_ADDRESSES_250
+#undef ALPACA_ADDRESSES_251
+#undef ALPACA_ADDRESSES_252
+#undef ALPACA_ADDRESSES_253
+#undef ALPACA_ADDRESSES_254
+#undef ALPACA_ADDRESSES_255
+#undef ALPACA_ADDRESSES_256
+#undef ALPACA_FIELD_BLOCK_0
+#undef ALPACA_ADDRESS_BLOCK_0
+#undef ALPACA_FIELD_BLOCK_1
+#undef ALPACA_ADDRESS_BLOCK_1
+#undef ALPACA_FIELD_BLOCK_2
+#undef ALPACA_ADDRESS_BLOCK_2
+#undef ALPACA_FIELD_BLOCK_3
+#undef ALPACA_ADDRESS_BLOCK_3
+#undef ALPACA_FIELD_BLOCK_4
+#undef ALPACA_ADDRESS_BLOCK_4
+#undef ALPACA_FIELD_BLOCK_5
+#undef ALPACA_ADDRESS_BLOCK_5
+#undef ALPACA_FIELD_BLOCK_6
+#undef ALPACA_ADDRESS_BLOCK_6
+#undef ALPACA_FIELD_BLOCK_7
+#undef ALPACA_ADDRESS_BLOCK_7
+#undef ALPACA_FIELD_BLOCK_8
+#undef ALPACA_ADDRESS_BLOCK_8
+#undef ALPACA_FIELD_BLOCK_9
+#undef ALPACA_ADDRESS_BLOCK_9
+#undef ALPACA_FIELD_BLOCK_10
+#undef ALPACA_ADDRESS_BLOCK_10
+#undef ALPACA_FIELD_BLOCK_11
+#undef ALPACA_ADDRESS_BLOCK_11
+#undef ALPACA_FIELD_BLOCK_12
+#undef ALPACA_ADDRESS_BLOCK_12
+#undef ALPACA_FIELD_BLOCK_13
+#undef ALPACA_ADDRESS_BLOCK_13
+#undef ALPACA_FIELD_BLOCK_14
+#undef ALPACA_ADDRESS_BLOCK_14
+#undef ALPACA_FIELD_BLOCK_15
+#undef ALPACA_ADDRESS_BLOCK_15
+
+// largest number of fields supported by get
+constexpr std::size_t max_aggregate_arity = 256;
+
 template <std::size_t index, typename type,
           std::size_t arity = aggregate_arity<std::remove_cv_t<type>>::size()>
 constexpr decltype(auto) get(type &value) noexcept {
-
-  if constexpr (arity == 1) {
-    auto &[p1] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 2) {
-    auto &[p1, p2] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 3) {
-    auto &[p1, p2, p3] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 4) {
-    auto &[p1, p2, p3, p4] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 5) {
-    auto &[p1, p2, p3, p4, p5] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 6) {
-    auto &[p1, p2, p3, p4, p5, p6] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 7) {
-    auto &[p1, p2, p3, p4, p5, p6, p7] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 8) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 9) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 10) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 11) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 12) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 13) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 14) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 15) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15] =
-        value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 16) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 17) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 18) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 19) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 20) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 21) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 22) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 23) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 24) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 25) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 26) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 27) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 28) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28] =
-        value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 29) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28,
-           p29] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 30) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 31) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 32) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 33) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 34) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 35) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 36) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 37) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 38) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 39) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 40) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 41) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 42) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42] =
-        value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 43) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42,
-           p43] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 44) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 45) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 46) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 47) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 48) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 49) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 50) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 51) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 52) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 53) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 54) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 55) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 56) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56] =
-        value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 57) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56,
-           p57] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 58) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 59) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 60) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 61) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 62) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 63) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 64) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 65) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 66) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 67) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 68) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 69) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 70) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70] =
-        value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 71) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70,
-           p71] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 72) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 73) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 74) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 75) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 76) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 77) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 78) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 79) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 80) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 81) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 82) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 83) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 84) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84] =
-        value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 85) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84,
-           p85] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 86) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 87) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 88) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 89) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 90) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 91) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 92) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91, p92] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else if constexpr (index == 91) {
-      return (p92);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 93) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91, p92, p93] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else if constexpr (index == 91) {
-      return (p92);
-    } else if constexpr (index == 92) {
-      return (p93);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 94) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91, p92, p93, p94] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else if constexpr (index == 91) {
-      return (p92);
-    } else if constexpr (index == 92) {
-      return (p93);
-    } else if constexpr (index == 93) {
-      return (p94);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 95) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91, p92, p93, p94, p95] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else if constexpr (index == 91) {
-      return (p92);
-    } else if constexpr (index == 92) {
-      return (p93);
-    } else if constexpr (index == 93) {
-      return (p94);
-    } else if constexpr (index == 94) {
-      return (p95);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 96) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91, p92, p93, p94, p95, p96] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else if constexpr (index == 91) {
-      return (p92);
-    } else if constexpr (index == 92) {
-      return (p93);
-    } else if constexpr (index == 93) {
-      return (p94);
-    } else if constexpr (index == 94) {
-      return (p95);
-    } else if constexpr (index == 95) {
-      return (p96);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 97) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91, p92, p93, p94, p95, p96, p97] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else if constexpr (index == 91) {
-      return (p92);
-    } else if constexpr (index == 92) {
-      return (p93);
-    } else if constexpr (index == 93) {
-      return (p94);
-    } else if constexpr (index == 94) {
-      return (p95);
-    } else if constexpr (index == 95) {
-      return (p96);
-    } else if constexpr (index == 96) {
-      return (p97);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 98) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91, p92, p93, p94, p95, p96, p97, p98] =
-        value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else if constexpr (index == 91) {
-      return (p92);
-    } else if constexpr (index == 92) {
-      return (p93);
-    } else if constexpr (index == 93) {
-      return (p94);
-    } else if constexpr (index == 94) {
-      return (p95);
-    } else if constexpr (index == 95) {
-      return (p96);
-    } else if constexpr (index == 96) {
-      return (p97);
-    } else if constexpr (index == 97) {
-      return (p98);
-    } else {
-      return;
-    }
-  } else if constexpr (arity == 99) {
-    auto &[p1, p2, p3, p4, p5, p6, p7, p8, p9, p10, p11, p12, p13, p14, p15,
-           p16, p17, p18, p19, p20, p21, p22, p23, p24, p25, p26, p27, p28, p29,
-           p30, p31, p32, p33, p34, p35, p36, p37, p38, p39, p40, p41, p42, p43,
-           p44, p45, p46, p47, p48, p49, p50, p51, p52, p53, p54, p55, p56, p57,
-           p58, p59, p60, p61, p62, p63, p64, p65, p66, p67, p68, p69, p70, p71,
-           p72, p73, p74, p75, p76, p77, p78, p79, p80, p81, p82, p83, p84, p85,
-           p86, p87, p88, p89, p90, p91, p92, p93, p94, p95, p96, p97, p98,
-           p99] = value;
-    if constexpr (index == 0) {
-      return (p1);
-    } else if constexpr (index == 1) {
-      return (p2);
-    } else if constexpr (index == 2) {
-      return (p3);
-    } else if constexpr (index == 3) {
-      return (p4);
-    } else if constexpr (index == 4) {
-      return (p5);
-    } else if constexpr (index == 5) {
-      return (p6);
-    } else if constexpr (index == 6) {
-      return (p7);
-    } else if constexpr (index == 7) {
-      return (p8);
-    } else if constexpr (index == 8) {
-      return (p9);
-    } else if constexpr (index == 9) {
-      return (p10);
-    } else if constexpr (index == 10) {
-      return (p11);
-    } else if constexpr (index == 11) {
-      return (p12);
-    } else if constexpr (index == 12) {
-      return (p13);
-    } else if constexpr (index == 13) {
-      return (p14);
-    } else if constexpr (index == 14) {
-      return (p15);
-    } else if constexpr (index == 15) {
-      return (p16);
-    } else if constexpr (index == 16) {
-      return (p17);
-    } else if constexpr (index == 17) {
-      return (p18);
-    } else if constexpr (index == 18) {
-      return (p19);
-    } else if constexpr (index == 19) {
-      return (p20);
-    } else if constexpr (index == 20) {
-      return (p21);
-    } else if constexpr (index == 21) {
-      return (p22);
-    } else if constexpr (index == 22) {
-      return (p23);
-    } else if constexpr (index == 23) {
-      return (p24);
-    } else if constexpr (index == 24) {
-      return (p25);
-    } else if constexpr (index == 25) {
-      return (p26);
-    } else if constexpr (index == 26) {
-      return (p27);
-    } else if constexpr (index == 27) {
-      return (p28);
-    } else if constexpr (index == 28) {
-      return (p29);
-    } else if constexpr (index == 29) {
-      return (p30);
-    } else if constexpr (index == 30) {
-      return (p31);
-    } else if constexpr (index == 31) {
-      return (p32);
-    } else if constexpr (index == 32) {
-      return (p33);
-    } else if constexpr (index == 33) {
-      return (p34);
-    } else if constexpr (index == 34) {
-      return (p35);
-    } else if constexpr (index == 35) {
-      return (p36);
-    } else if constexpr (index == 36) {
-      return (p37);
-    } else if constexpr (index == 37) {
-      return (p38);
-    } else if constexpr (index == 38) {
-      return (p39);
-    } else if constexpr (index == 39) {
-      return (p40);
-    } else if constexpr (index == 40) {
-      return (p41);
-    } else if constexpr (index == 41) {
-      return (p42);
-    } else if constexpr (index == 42) {
-      return (p43);
-    } else if constexpr (index == 43) {
-      return (p44);
-    } else if constexpr (index == 44) {
-      return (p45);
-    } else if constexpr (index == 45) {
-      return (p46);
-    } else if constexpr (index == 46) {
-      return (p47);
-    } else if constexpr (index == 47) {
-      return (p48);
-    } else if constexpr (index == 48) {
-      return (p49);
-    } else if constexpr (index == 49) {
-      return (p50);
-    } else if constexpr (index == 50) {
-      return (p51);
-    } else if constexpr (index == 51) {
-      return (p52);
-    } else if constexpr (index == 52) {
-      return (p53);
-    } else if constexpr (index == 53) {
-      return (p54);
-    } else if constexpr (index == 54) {
-      return (p55);
-    } else if constexpr (index == 55) {
-      return (p56);
-    } else if constexpr (index == 56) {
-      return (p57);
-    } else if constexpr (index == 57) {
-      return (p58);
-    } else if constexpr (index == 58) {
-      return (p59);
-    } else if constexpr (index == 59) {
-      return (p60);
-    } else if constexpr (index == 60) {
-      return (p61);
-    } else if constexpr (index == 61) {
-      return (p62);
-    } else if constexpr (index == 62) {
-      return (p63);
-    } else if constexpr (index == 63) {
-      return (p64);
-    } else if constexpr (index == 64) {
-      return (p65);
-    } else if constexpr (index == 65) {
-      return (p66);
-    } else if constexpr (index == 66) {
-      return (p67);
-    } else if constexpr (index == 67) {
-      return (p68);
-    } else if constexpr (index == 68) {
-      return (p69);
-    } else if constexpr (index == 69) {
-      return (p70);
-    } else if constexpr (index == 70) {
-      return (p71);
-    } else if constexpr (index == 71) {
-      return (p72);
-    } else if constexpr (index == 72) {
-      return (p73);
-    } else if constexpr (index == 73) {
-      return (p74);
-    } else if constexpr (index == 74) {
-      return (p75);
-    } else if constexpr (index == 75) {
-      return (p76);
-    } else if constexpr (index == 76) {
-      return (p77);
-    } else if constexpr (index == 77) {
-      return (p78);
-    } else if constexpr (index == 78) {
-      return (p79);
-    } else if constexpr (index == 79) {
-      return (p80);
-    } else if constexpr (index == 80) {
-      return (p81);
-    } else if constexpr (index == 81) {
-      return (p82);
-    } else if constexpr (index == 82) {
-      return (p83);
-    } else if constexpr (index == 83) {
-      return (p84);
-    } else if constexpr (index == 84) {
-      return (p85);
-    } else if constexpr (index == 85) {
-      return (p86);
-    } else if constexpr (index == 86) {
-      return (p87);
-    } else if constexpr (index == 87) {
-      return (p88);
-    } else if constexpr (index == 88) {
-      return (p89);
-    } else if constexpr (index == 89) {
-      return (p90);
-    } else if constexpr (index == 90) {
-      return (p91);
-    } else if constexpr (index == 91) {
-      return (p92);
-    } else if constexpr (index == 92) {
-      return (p93);
-    } else if constexpr (index == 93) {
-      return (p94);
-    } else if constexpr (index == 94) {
-      return (p95);
-    } else if constexpr (index == 95) {
-      return (p96);
-    } else if constexpr (index == 96) {
-      return (p97);
-    } else if constexpr (index == 97) {
-      return (p98);
-    } else if constexpr (index == 98) {
-      return (p99);
-    } else {
-      return;
-    }
-  } else /* extend it by yourself for higher arities */ {
-    return;
-  }
+  static_assert(arity <= max_aggregate_arity,
+                "structs with more than 256 fields are not supported");
+  static_assert(index < arity, "field index out of range");
+  return field_of<arity>::template get<index>(value);
 }
+
+// type of the index-th field of struct type (with arity fields)
+template <typename type, std::size_t arity, std::size_t index>
+using nth_field_type_t = typename std::decay<decltype(get<index, type, arity>(
+    std::declval<type &>()))>::type;
+
 } // namespace detail
 
-} // namespace alpaca
\ No newline at end of file
+} // namespace alpaca
@@ -0,0 +1,142 @@
+#pragma once
+#include <algorithm>
+#include <atomic>
+#include <condition_variable>
+#include <cstddef>
+#include <mutex>
+#include <thread>
+#include <type_traits>
+#include <vector>
+
+namespace alpaca {
+
+// Executors run `num_tasks` independent tasks, f(0), ..., f(num_tasks - 1),
+// and return when all of them are done:
+//
+//   template <typename F> void execute(std::size_t num_tasks, F &&f);
+//
+// Tasks must not throw.
+
+// runs every task on the calling thread
+class inline_executor {
+public:
+  std::size_t concurrency() const noexcept { return 1; }
+
+  template <typename F> void execute(std::size_t num_tasks, F &&f) {
+    for (std::size_t i = 0; i < num_tasks; ++i) {
+      f(i);
+    }
+  }
+};
+
+// A fixed set of worker threads that, together with the calling thread, run
+// the tasks of one execute() call at a time
+// Idle threads claim the next task from a shared counter, so a thread that
+// finishes early keeps taking work instead of waiting for the others
+class thread_pool {
+public:
+  // `num_threads` includes the thread that calls execute()
+  explicit thread_pool(std::size_t num_threads =
+                           std::max(1u, std::thread::hardware_concurrency())) {
+    for (std::size_t i = 1; i < num_threads; ++i) {
+      workers_.emplace_back([this] { work(); });
+    }
+  }
+
+  ~thread_pool() {
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      stop_ = true;
+    }
+    wake_.notify_all();
+    for (auto &worker : workers_) {
+      worker.join();
+    }
+  }
+
+  thread_pool(const thread_pool &) = delete;
+  thread_pool &operator=(const thread_pool &) = delete;
+
+  std::size_t concurrency() const noexcept { return workers_.size() + 1; }
+
+  template <typename F> void execute(std::size_t num_tasks, F &&f) {
+    using function = std::remove_reference_t<F>;
+
+    if (workers_.empty() || num_tasks <= 1) {
+      inline_executor{}.execute(num_tasks, f);
+      return;
+    }
+
+    // one batch at a time
+    std::lock_guard<std::mutex> execute_lock(execute_mutex_);
+
+    {
+      std::lock_guard<std::mutex> lock(mutex_);
+      invoke_ = [](void *context, std::size_t task) {
+        (*static_cast<function *>(context))(task);
+      };
+      context_ = const_cast<void *>(static_cast<const void *>(&f));
+      num_tasks_ = num_tasks;
+      next_task_.store(0, std::memory_order_relaxed);
+      num_busy_ = workers_.size();
+      ++generation_;
+    }
+    wake_.notify_all();
+
+    run_tasks();
+
+    std::unique_lock<std::mutex> lock(mutex_);
+    done_.wait(lock, [this] { return num_busy_ == 0; });
+  }
+
+private:
+  void run_tasks() {
+    for (auto task = next_task_.fetch_add(1, std::memory_order_relaxed);
+         task < num_tasks_;
+         task = next_task_.fetch_add(1, std::memory_order_relaxed)) {
+      invoke_(context_, task);
+    }
+  }
+
+  void work() {
+    std::size_t generation = 0;
+    while (true) {
+      {
+        std::unique_lock<std::mutex> lock(mutex_);
+        wake_.wait(lock,
+                   [&] { return stop_ || generation_ != generation; });
+        if (stop_) {
+          return;
+        }
+        generation = generation_;
+      }
+
+      run_tasks();
+
+      {
+        std::lock_guard<std::mutex> lock(mutex_);
+        if (--num_busy_ == 0) {
+          done_.notify_one();
+        }
+      }
+    }
+  }
+
+  std::vector<std::thread> workers_;
+
+  std::mutex execute_mutex_;
+  std::mutex mutex_;
+  std::condition_variable wake_;
+  std::condition_variable done_;
+  bool stop_{false};
+  std::size_t generation_{0};
+  std::size_t num_busy_{0};
+
+  // the current batch, set under mutex_ before workers are woken
+  void (*invoke_)(void *, std::size_t){nullptr};
+  void *context_{nullptr};
+  std::size_t num_tasks_{0};
+  std::atomic<std::size_t> next_task_{0};
+};
+
+} // namespace alpaca
@@ -1,5 +1,7 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_ARRAY
+#include <alpaca/detail/fixed_layout.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/type_info.h>
 #include <array>
 #include <system_error>
@@ -25,9 +27,14 @@ void to_bytes_router(const T &input, Container &bytes, std::size_t &byte_index);
 template <options O, typename Container, typename T, std::size_t N>
 void to_bytes(Container &bytes, std::size_t &byte_index,
               const std::array<T, N> &input) {
-  // value of each element in list
-  for (const auto &v : input) {
-    to_bytes_router<O>(v, bytes, byte_index);
+  if constexpr (fixed_serialized_size<O, std::array<T, N>>() > 0) {
+    // every element has a fixed size - write the whole array at once
+    to_bytes_fixed<O, std::array<T, N>, 0>(input, bytes, byte_index);
+  } else {
+    // value of each element in list
+    for (const auto &v : input) {
+      to_bytes_router<O>(v, bytes, byte_index);
+    }
   }
 }
 
@@ -55,7 +62,7 @@ void from_bytes_to_array(T &value, Container &bytes, std::size_t &current_index,
   for (std::size_t i = 0; i < size; ++i) {
     decayed_value_type v{};
     from_bytes_router<O>(v, bytes, current_index, end_index, error_code);
-    value[i] = v;
+    value[i] = std::move(v);
   }
 }
 
@@ -74,6 +81,38 @@ bool from_bytes(std::array<U, N> &output, Container &bytes,
   return true;
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_array_type<T>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  constexpr auto size = std::tuple_size<T>::value;
+
+  if (size > end_index - current_index) {
+    // size is greater than the number of bytes remaining
+    error_code = std::make_error_code(std::errc::value_too_large);
+
+    // stop here
+    return false;
+  }
+
+  // skip `size` values
+  for (std::size_t i = 0; i < size; ++i) {
+    if (!skip<O, typename T::value_type>(bytes, current_index, end_index,
+                                         error_code)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 } // namespace detail
 
 } // namespace alpaca
@@ -1,5 +1,6 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_BITSET
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/to_bytes.h>
 #include <alpaca/detail/type_info.h>
 #include <system_error>
@@ -11,12 +12,11 @@ namespace detail {
 
 template <typename T>
 typename std::enable_if<is_bitset<T>::value, void>::type
-type_info(
-    std::vector<uint8_t> &typeids,
-    std::unordered_map<std::string_view, std::size_t> &struct_visitor_map) {
+type_info(std::vector<uint8_t> &typeids,
+          std::unordered_map<std::string_view, std::size_t> &) {
   typeids.push_back(to_byte<field_type::bitset>());
-  using value_type = typename T::value_type;
-  type_info<value_type>(typeids, struct_visitor_map);
+  // number of bits, truncated like the size of std::array
+  typeids.push_back(static_cast<uint8_t>(T{}.size()));
 }
 
 template <options O, std::size_t N, typename Container>
@@ -34,7 +34,7 @@ void to_bytes_from_bitset_type(const std::bitset<N> &input, Container &bytes,
     uint8_t byte = 0;
     for (int bit = 0; bit < 8; ++bit) {
       int bit_index = i * 8 + bit;
-      if (bit_index > input.size()) break;
+      if (static_cast<std::size_t>(bit_index) >= input.size()) break;
       if (input[bit_index]) byte |= (1 << bit);
     }
     to_bytes<O>(bytes, byte_index, byte);
@@ -99,8 +99,8 @@ bool from_bytes_to_bitset(std::bitset<N> &value, Container &bytes,
     }
     // loop over the bits
     for (int j=0; j<8; ++j) {
-      int bit_index = i * 8 + j;
-      if (bit_index > size) break;
+      std::size_t bit_index = i * 8 + j;
+      if (bit_index >= size) break;
       bool bit = static_cast<bool>(byte & (1 << j));
       value[bit_index] = bit;
     }
@@ -117,6 +117,46 @@ bool from_bytes(std::bitset<N> &output, Container &bytes,
                                  error_code);
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_bitset<T>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  // current byte is the number of bits
+  std::size_t size = 0;
+  if (!read_length<O>(size, bytes, current_index, end_index, error_code)) {
+    return false;
+  }
+
+  if (size != T{}.size()) {
+    // the bitset we received is not the same size as the bitset we expect
+    error_code = std::make_error_code(std::errc::invalid_argument);
+
+    // stop here
+    return false;
+  }
+
+  // bits are packed into (size/8 + 1) bytes
+  std::size_t num_serialized_bytes = size / 8 + 1;
+
+  if (num_serialized_bytes > end_index - current_index) {
+    // size is greater than the number of bytes remaining
+    error_code = std::make_error_code(std::errc::value_too_large);
+
+    // stop here
+    return false;
+  }
+
+  current_index += num_serialized_bytes;
+  return true;
+}
+
 } // namespace detail
 
 } // namespace alpaca
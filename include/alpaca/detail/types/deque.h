@@ -1,5 +1,7 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_DEQUE
+#include <alpaca/detail/decode_limits.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/to_bytes.h>
 #include <alpaca/detail/type_info.h>
 #include <deque>
@@ -69,6 +71,12 @@ bool from_bytes_to_deque(std::deque<T> &value, Container &bytes,
     return false;
   }
 
+  depth_guard guard(error_code);
+  if (!guard || !check_decode_limits<T>(size, error_code)) {
+    // limits exceeded
+    return false;
+  }
+
   // read `size` bytes and save to value
   for (std::size_t i = 0; i < size; ++i) {
     T v{};
@@ -77,7 +85,7 @@ bool from_bytes_to_deque(std::deque<T> &value, Container &bytes,
       // something went wrong
       return false;
     }
-    value.push_back(v);
+    value.push_back(std::move(v));
   }
 
   return true;
@@ -91,6 +99,42 @@ bool from_bytes(std::deque<T> &output, Container &bytes,
                                 error_code);
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::deque>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  // current byte is the size of the deque
+  std::size_t size = 0;
+  if (!read_length<O>(size, bytes, current_index, end_index, error_code)) {
+    return false;
+  }
+
+  if (size > end_index - current_index) {
+    // size is greater than the number of bytes remaining
+    error_code = std::make_error_code(std::errc::value_too_large);
+
+    // stop here
+    return false;
+  }
+
+  // skip `size` values
+  for (std::size_t i = 0; i < size; ++i) {
+    if (!skip<O, typename T::value_type>(bytes, current_index, end_index,
+                                         error_code)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 } // namespace detail
 
 } // namespace alpaca
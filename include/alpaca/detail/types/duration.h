@@ -1,6 +1,7 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_CHRONO
 #include <alpaca/detail/options.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/type_info.h>
 #include <chrono>
 #include <system_error>
@@ -59,6 +60,16 @@ bool from_bytes(std::chrono::duration<Rep, Period> &output, Container &bytes,
   return true;
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::chrono::duration>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  // only the count is stored
+  return skip<O, typename T::rep>(bytes, current_index, end_index,
+                                  error_code);
+}
+
 } // namespace detail
 
 } // namespace alpaca
@@ -1,6 +1,7 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_FILESYSTEM_PATH
 #include <alpaca/detail/from_bytes.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/to_bytes.h>
 #include <alpaca/detail/type_info.h>
 #include <filesystem>
@@ -73,6 +74,16 @@ bool from_bytes(std::filesystem::path &value, Container &bytes,
   return true;
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<std::is_same<T, std::filesystem::path>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  // a path is stored like its native string
+  return skip<O, std::filesystem::path::string_type>(bytes, current_index,
+                                                     end_index, error_code);
+}
+
 } // namespace detail
 
 } // namespace alpaca
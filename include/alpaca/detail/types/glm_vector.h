@@ -1,5 +1,6 @@
 #pragma once
 #ifdef ALPACA_INCLUDE_SUPPORT_GLM_VECTOR
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/types/array.h>
 
 #include <glm/ext/vector_float3.hpp>
@@ -46,6 +47,15 @@ bool from_bytes(glm::vec<L, T, Q> &output, Container &bytes, std::size_t &byte_i
     return true;
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_glm_vec<T>::value, bool>::type
+skip(Container &bytes, std::size_t &byte_index, std::size_t &end_index,
+     std::error_code &error_code) {
+    // stored like the equivalent std::array
+    return skip<O, std::array<typename T::value_type, T::length()>>(
+        bytes, byte_index, end_index, error_code);
+}
+
 }  // namespace detail
 
 }  // namespace alpaca
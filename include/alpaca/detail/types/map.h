@@ -1,4 +1,6 @@
 #pragma once
+#include <alpaca/detail/decode_limits.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/type_info.h>
 #include <alpaca/detail/variable_length_encoding.h>
 
@@ -96,6 +98,17 @@ void from_bytes_to_map(T &map, Container &bytes, std::size_t &current_index,
     return;
   }
 
+  depth_guard guard(error_code);
+  if (!guard ||
+      !check_decode_limits<typename T::value_type>(size, error_code)) {
+    // limits exceeded
+    return;
+  }
+
+  if constexpr (is_specialization<T, std::unordered_map>::value) {
+    map.reserve(map.size() + size);
+  }
+
   // read `size` bytes and save to value
   for (std::size_t i = 0; i < size; ++i) {
     typename T::key_type key{};
@@ -104,7 +117,14 @@ void from_bytes_to_map(T &map, Container &bytes, std::size_t &current_index,
     typename T::mapped_type value{};
     from_bytes_router<O>(value, bytes, current_index, end_index, error_code);
 
-    map.insert(std::make_pair(key, value));
+    if (error_code) {
+      // something went wrong
+      return;
+    }
+
+    // keys are serialized in order, so for std::map the end is the right
+    // place and the insertion is amortized O(1)
+    map.emplace_hint(map.end(), std::move(key), std::move(value));
   }
 }
 
@@ -142,6 +162,62 @@ bool from_bytes(std::unordered_map<K, V> &output, Container &bytes,
 }
 #endif
 
+template <options O, typename T, typename Container>
+bool skip_map(Container &bytes, std::size_t &current_index,
+              std::size_t &end_index, std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  // current byte is the size of the map
+  std::size_t size = 0;
+  if (!read_length<O>(size, bytes, current_index, end_index, error_code)) {
+    return false;
+  }
+
+  if (size > end_index - current_index) {
+    // size is greater than the number of bytes remaining
+    error_code = std::make_error_code(std::errc::value_too_large);
+
+    // stop here
+    return false;
+  }
+
+  // skip `size` key,value pairs
+  for (std::size_t i = 0; i < size; ++i) {
+    if (!skip<O, typename T::key_type>(bytes, current_index, end_index,
+                                       error_code) ||
+        !skip<O, typename T::mapped_type>(bytes, current_index, end_index,
+                                          error_code)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_MAP
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::map>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  return skip_map<O, T>(bytes, current_index, end_index, error_code);
+}
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_UNORDERED_MAP
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::unordered_map>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  return skip_map<O, T>(bytes, current_index, end_index, error_code);
+}
+#endif
+
 } // namespace detail
 
 } // namespace alpaca
\ No newline at end of file
@@ -1,5 +1,6 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_OPTIONAL
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/type_info.h>
 #include <optional>
 #include <system_error>
@@ -69,7 +70,40 @@ bool from_bytes(std::optional<T> &output, Container &bytes,
     // read value of optional
     T value;
     from_bytes_router<O>(value, bytes, byte_index, end_index, error_code);
-    output = value;
+    output = std::move(value);
+  }
+
+  return true;
+}
+
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::optional>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  auto current_byte = bytes[current_index];
+
+  // check if has_value has a legal value of either 0 or 1
+  if (current_byte != 0x00 && current_byte != 0x01) {
+    // expected either 0 or 1, got something else
+    error_code = std::make_error_code(std::errc::illegal_byte_sequence);
+
+    // stop here
+    return false;
+  }
+
+  // current byte is the `has_value` byte
+  bool has_value = static_cast<bool>(bytes[current_index++]);
+
+  if (has_value) {
+    return skip<O, typename T::value_type>(bytes, current_index, end_index,
+                                           error_code);
   }
 
   return true;
@@ -1,5 +1,6 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_PAIR
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/type_info.h>
 #include <system_error>
 #include <utility>
@@ -54,6 +55,16 @@ bool from_bytes(std::pair<T, U> &output, Container &bytes,
   return true;
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::pair>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  return skip<O, typename T::first_type>(bytes, current_index, end_index,
+                                         error_code) &&
+         skip<O, typename T::second_type>(bytes, current_index, end_index,
+                                          error_code);
+}
+
 } // namespace detail
 
 } // namespace alpaca
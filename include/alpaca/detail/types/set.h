@@ -1,4 +1,6 @@
 #pragma once
+#include <alpaca/detail/decode_limits.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/to_bytes.h>
 #include <alpaca/detail/type_info.h>
 
@@ -94,11 +96,30 @@ void from_bytes_to_set(T &set, Container &bytes, std::size_t &current_index,
     return;
   }
 
+  depth_guard guard(error_code);
+  if (!guard ||
+      !check_decode_limits<typename T::value_type>(size, error_code)) {
+    // limits exceeded
+    return;
+  }
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_UNORDERED_SET
+  if constexpr (is_specialization<T, std::unordered_set>::value) {
+    set.reserve(set.size() + size);
+  }
+#endif
+
   // read `size` bytes and save to value
   for (std::size_t i = 0; i < size; ++i) {
     typename T::value_type value{};
     from_bytes_router<O>(value, bytes, current_index, end_index, error_code);
-    set.insert(value);
+    if (error_code) {
+      // something went wrong
+      return;
+    }
+    // values are serialized in order, so for std::set the end is the right
+    // place and the insertion is amortized O(1)
+    set.emplace_hint(set.end(), std::move(value));
   }
 }
 
@@ -135,6 +156,60 @@ bool from_bytes(std::unordered_set<T> &output, Container &bytes,
 }
 #endif
 
+template <options O, typename T, typename Container>
+bool skip_set(Container &bytes, std::size_t &current_index,
+              std::size_t &end_index, std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  // current byte is the size of the set
+  std::size_t size = 0;
+  if (!read_length<O>(size, bytes, current_index, end_index, error_code)) {
+    return false;
+  }
+
+  if (size > end_index - current_index) {
+    // size is greater than the number of bytes remaining
+    error_code = std::make_error_code(std::errc::value_too_large);
+
+    // stop here
+    return false;
+  }
+
+  // skip `size` values
+  for (std::size_t i = 0; i < size; ++i) {
+    if (!skip<O, typename T::value_type>(bytes, current_index, end_index,
+                                         error_code)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_SET
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::set>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  return skip_set<O, T>(bytes, current_index, end_index, error_code);
+}
+#endif
+
+#ifndef ALPACA_EXCLUDE_SUPPORT_STD_UNORDERED_SET
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::unordered_set>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  return skip_set<O, T>(bytes, current_index, end_index, error_code);
+}
+#endif
+
 } // namespace detail
 
 } // namespace alpaca
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_STRING
+#include <alpaca/detail/decode_limits.h>
 #include <alpaca/detail/from_bytes.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/to_bytes.h>
 #include <alpaca/detail/type_info.h>
 #include <string>
@@ -61,8 +63,13 @@ from_bytes(std::basic_string<CharType> &value, Container &bytes,
     return false;
   }
 
+  if (!check_decode_limits<CharType>(size, error_code)) {
+    // limits exceeded
+    return false;
+  }
+
   // read `size` bytes and save to value
-  value.reserve(size * sizeof(CharType));
+  value.reserve(size);
   for (std::size_t i = 0; i < size; ++i) {
     CharType character{};
     from_bytes<O>(character, bytes, current_index, end_index, error_code);
@@ -101,8 +108,13 @@ from_bytes(std::basic_string<CharType> &value, Container &bytes,
     return false;
   }
 
+  if (!check_decode_limits<CharType>(size, error_code)) {
+    // limits exceeded
+    return false;
+  }
+
   // read `size` bytes and save to value
-  value.reserve(size * sizeof(CharType));
+  value.reserve(size);
   for (std::size_t i = 0; i < size; ++i) {
     CharType character;
     from_bytes<O>(character, bytes, current_index, end_index, error_code);
@@ -112,6 +124,44 @@ from_bytes(std::basic_string<CharType> &value, Container &bytes,
   return true;
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::basic_string>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  // current byte is the length of the string
+  std::size_t size = 0;
+  if (!read_length<O>(size, bytes, current_index, end_index, error_code)) {
+    return false;
+  }
+
+  if (size > end_index - current_index) {
+    // size is greater than the number of bytes remaining
+    error_code = std::make_error_code(std::errc::value_too_large);
+
+    // stop here
+    return false;
+  }
+
+  // characters are stored as is
+  const auto num_bytes = size * sizeof(typename T::value_type);
+  if (num_bytes > end_index - current_index) {
+    // string is cut short
+    error_code = std::make_error_code(std::errc::message_size);
+    return false;
+  }
+
+  current_index += num_bytes;
+  return true;
+}
+
 } // namespace detail
 
 } // namespace alpaca
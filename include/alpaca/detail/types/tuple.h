@@ -1,5 +1,6 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_TUPLE
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/type_info.h>
 #include <system_error>
 #include <tuple>
@@ -98,6 +99,24 @@ bool from_bytes(std::tuple<T...> &output, Container &bytes,
   return true;
 }
 
+template <options O, typename T, typename Container, std::size_t... I>
+bool skip_tuple_values(Container &bytes, std::size_t &current_index,
+                       std::size_t &end_index, std::error_code &error_code,
+                       std::index_sequence<I...>) {
+  return (skip<O, std::tuple_element_t<I, T>>(bytes, current_index, end_index,
+                                              error_code) &&
+          ...);
+}
+
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::tuple>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+  return skip_tuple_values<O, T>(
+      bytes, current_index, end_index, error_code,
+      std::make_index_sequence<std::tuple_size_v<T>>{});
+}
+
 } // namespace detail
 
 } // namespace alpaca
@@ -1,5 +1,7 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_UNIQUE_PTR
+#include <alpaca/detail/decode_limits.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/to_bytes.h>
 #include <alpaca/detail/type_info.h>
 #include <memory>
@@ -71,6 +73,12 @@ bool from_bytes(std::unique_ptr<T> &output, Container &bytes,
   bool has_value = static_cast<bool>(bytes[byte_index++]);
 
   if (has_value) {
+    depth_guard guard(error_code);
+    if (!guard || !check_decode_limits<T>(1, error_code)) {
+      // limits exceeded
+      return false;
+    }
+
     // read value of unique_ptr
     T value{};
     from_bytes_router<O>(value, bytes, byte_index, end_index, error_code);
@@ -82,6 +90,40 @@ bool from_bytes(std::unique_ptr<T> &output, Container &bytes,
   return true;
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::unique_ptr>::value,
+                        bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  auto current_byte = bytes[current_index];
+
+  // check if has_value has a legal value of either 0 or 1
+  if (current_byte != 0x00 && current_byte != 0x01) {
+    // expected either 0 or 1, got something else
+    error_code = std::make_error_code(std::errc::illegal_byte_sequence);
+
+    // stop here
+    return false;
+  }
+
+  // current byte is the `has_value` byte
+  bool has_value = static_cast<bool>(bytes[current_index++]);
+
+  if (has_value) {
+    return skip<O, typename T::element_type>(bytes, current_index, end_index,
+                                             error_code);
+  }
+
+  return true;
+}
+
 } // namespace detail
 
 } // namespace alpaca
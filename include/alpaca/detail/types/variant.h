@@ -1,5 +1,6 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_VARIANT
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/type_info.h>
 #include <alpaca/detail/variable_length_encoding.h>
 #include <alpaca/detail/variant_nth_field.h>
@@ -76,6 +77,50 @@ bool from_bytes(std::variant<T...> &output, Container &bytes,
   return true;
 }
 
+template <options O, typename T, typename Container, std::size_t... I>
+bool skip_variant_value(std::size_t index, Container &bytes,
+                        std::size_t &current_index, std::size_t &end_index,
+                        std::error_code &error_code,
+                        std::index_sequence<I...>) {
+  using skipper =
+      bool (*)(Container &, std::size_t &, std::size_t &, std::error_code &);
+
+  // one entry per alternative, indexed by the variant index on the wire
+  static constexpr skipper skippers[] = {
+      &skip<O, std::variant_alternative_t<I, T>, Container>...};
+
+  return skippers[index](bytes, current_index, end_index, error_code);
+}
+
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::variant>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  // current byte is the index of the variant value
+  std::size_t index = 0;
+  if (!read_length<O>(index, bytes, current_index, end_index, error_code)) {
+    return false;
+  }
+
+  constexpr auto variant_size = std::variant_size_v<T>;
+  if (index >= variant_size) {
+    // no such alternative
+    error_code = std::make_error_code(std::errc::illegal_byte_sequence);
+    return false;
+  }
+
+  return skip_variant_value<O, T>(index, bytes, current_index, end_index,
+                                  error_code,
+                                  std::make_index_sequence<variant_size>{});
+}
+
 } // namespace detail
 
 } // namespace alpaca
@@ -1,7 +1,12 @@
 #pragma once
 #ifndef ALPACA_EXCLUDE_SUPPORT_STD_VECTOR
+#include <alpaca/detail/chunk_index.h>
+#include <alpaca/detail/decode_limits.h>
+#include <alpaca/detail/fixed_layout.h>
+#include <alpaca/detail/skip.h>
 #include <alpaca/detail/to_bytes.h>
 #include <alpaca/detail/type_info.h>
+#include <algorithm>
 #include <system_error>
 #include <vector>
 
@@ -35,10 +40,52 @@ void to_bytes_from_vector_type(const T &input, Container &bytes,
   }
 }
 
+// vector size, chunk sizes, then the elements - see chunk_index.h
+template <options O, typename T, typename Container>
+void to_bytes_from_vector_chunks(const T &input, Container &bytes,
+                                 std::size_t &byte_index) {
+  // save vector size
+  to_bytes_router<O, std::size_t>(input.size(), bytes, byte_index);
+
+  // leave room for the chunk sizes, filled in once each chunk is written
+  const auto num_chunks = num_vector_chunks(input.size());
+  const auto table_index = byte_index;
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    write_chunk_size<O>(0, bytes, byte_index);
+  }
+
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    const auto start = byte_index;
+    const auto first = chunk * vector_chunk_size;
+    const auto last = std::min(first + vector_chunk_size, input.size());
+    for (std::size_t i = first; i < last; ++i) {
+      to_bytes_router<O>(input[i], bytes, byte_index);
+    }
+    patch_chunk_size<O>(byte_index - start, bytes,
+                        table_index + chunk * chunk_size_bytes);
+  }
+}
+
 template <options O, typename Container, typename U>
 void to_bytes(Container &bytes, std::size_t &byte_index,
               const std::vector<U> &input) {
-  to_bytes_from_vector_type<O>(input, bytes, byte_index);
+  if constexpr (has_serialized_layout<O, U>()) {
+    // elements are stored as they are in memory - copy them all at once
+    to_bytes_router<O, std::size_t>(input.size(), bytes, byte_index);
+    if (!input.empty()) {
+      append_bytes(reinterpret_cast<const uint8_t *>(input.data()),
+                   input.size() * sizeof(U), bytes, byte_index);
+    }
+  } else if constexpr (with_chunk_index<O>() &&
+                       fixed_serialized_size<O, U>() == 0) {
+    if (input.size() > vector_chunk_size) {
+      to_bytes_from_vector_chunks<O>(input, bytes, byte_index);
+    } else {
+      to_bytes_from_vector_type<O>(input, bytes, byte_index);
+    }
+  } else {
+    to_bytes_from_vector_type<O>(input, bytes, byte_index);
+  }
 }
 
 // specialization for vector of bool
@@ -53,6 +100,110 @@ template <options O, typename T, typename Container>
 void from_bytes_router(T &output, Container &bytes, std::size_t &byte_index,
                        std::size_t &end_index, std::error_code &error_code);
 
+// Read the chunk sizes of a vector of `size` elements written with
+// options::with_chunk_index
+// starts[i] is the offset of chunk i from the first element, and
+// starts[num_chunks] the size of all elements
+template <options O, typename Container>
+bool read_vector_chunks(std::vector<std::size_t> &starts, std::size_t size,
+                        Container &bytes, std::size_t &current_index,
+                        std::size_t &end_index, std::error_code &error_code) {
+  const auto num_chunks = num_vector_chunks(size);
+  if (num_chunks > (end_index - current_index) / chunk_size_bytes) {
+    // chunk sizes run past the end of the input
+    error_code = std::make_error_code(std::errc::value_too_large);
+    return false;
+  }
+
+  starts.assign(num_chunks + 1, 0);
+  const auto table_index = current_index;
+  current_index += num_chunks * chunk_size_bytes;
+
+  const auto remaining = end_index - current_index;
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    const auto chunk_size = read_chunk_size<O>(
+        bytes, table_index + chunk * chunk_size_bytes);
+    if (chunk_size > remaining - starts[chunk]) {
+      // chunk runs past the end of the input
+      error_code = std::make_error_code(std::errc::value_too_large);
+      return false;
+    }
+    starts[chunk + 1] = starts[chunk] + static_cast<std::size_t>(chunk_size);
+  }
+  return true;
+}
+
+// decode the chunks of a vector written with options::with_chunk_index
+// into a presized vector, in parallel if deserialize_parallel installed an
+// executor
+template <options O, typename T, typename Container>
+bool from_bytes_vector_chunks(std::vector<T> &value, std::size_t size,
+                              Container &bytes, std::size_t &current_index,
+                              std::size_t &end_index,
+                              std::error_code &error_code) {
+  std::vector<std::size_t> starts;
+  if (!read_vector_chunks<O>(starts, size, bytes, current_index, end_index,
+                             error_code)) {
+    return false;
+  }
+
+  const auto num_chunks = starts.size() - 1;
+  const auto base = current_index;
+  value.resize(size);
+  std::vector<std::error_code> error_codes(num_chunks);
+
+  auto decode_chunk = [&](std::size_t chunk) {
+    // nested chunked vectors are decoded on this thread
+    decode_executor_scope sequential(nullptr);
+
+    std::size_t index = base + starts[chunk];
+    std::size_t chunk_end = base + starts[chunk + 1];
+    const auto first = chunk * vector_chunk_size;
+    const auto last = std::min(first + vector_chunk_size, size);
+    for (std::size_t i = first; i < last; ++i) {
+      if (index >= chunk_end) {
+        // chunk ends before its elements do
+        error_codes[chunk] =
+            std::make_error_code(std::errc::illegal_byte_sequence);
+        return;
+      }
+      from_bytes_router<O>(value[i], bytes, index, chunk_end,
+                           error_codes[chunk]);
+      if (error_codes[chunk]) {
+        return;
+      }
+    }
+    if (index != chunk_end) {
+      // chunk size does not match the elements
+      error_codes[chunk] =
+          std::make_error_code(std::errc::illegal_byte_sequence);
+    }
+  };
+
+  auto executor = current_decode_executor;
+  if (executor != nullptr && current_decode_context == nullptr) {
+    executor->execute(num_chunks, decode_chunk);
+  } else {
+    // limits are tracked per thread - decode on this thread
+    for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+      decode_chunk(chunk);
+      if (error_codes[chunk]) {
+        break;
+      }
+    }
+  }
+
+  for (const auto &chunk_error_code : error_codes) {
+    if (chunk_error_code) {
+      error_code = chunk_error_code;
+      return false;
+    }
+  }
+
+  current_index = base + starts[num_chunks];
+  return true;
+}
+
 template <options O, typename T, typename Container>
 bool from_bytes_to_vector(std::vector<T> &value, Container &bytes,
                           std::size_t &current_index, std::size_t &end_index,
@@ -77,8 +228,21 @@ bool from_bytes_to_vector(std::vector<T> &value, Container &bytes,
     return false;
   }
 
+  depth_guard guard(error_code);
+  if (!guard || !check_decode_limits<T>(size, error_code)) {
+    // limits exceeded
+    return false;
+  }
+
+  if constexpr (with_chunk_index<O>() && fixed_serialized_size<O, T>() == 0) {
+    if (size > vector_chunk_size) {
+      return from_bytes_vector_chunks<O>(value, size, bytes, current_index,
+                                         end_index, error_code);
+    }
+  }
+
   // read `size` bytes and save to value
-  value.reserve(size * sizeof(T));
+  value.reserve(size);
   for (std::size_t i = 0; i < size; ++i) {
     T v{};
     from_bytes_router<O>(v, bytes, current_index, end_index, error_code);
@@ -86,7 +250,7 @@ bool from_bytes_to_vector(std::vector<T> &value, Container &bytes,
       // something went wrong
       return false;
     }
-    value.push_back(v);
+    value.push_back(std::move(v));
   }
 
   return true;
@@ -109,6 +273,89 @@ bool from_bytes(std::vector<bool> &output, Container &bytes,
                                                   end_index, error_code);
 }
 
+template <options O, typename T, typename Container>
+typename std::enable_if<is_specialization<T, std::vector>::value, bool>::type
+skip(Container &bytes, std::size_t &current_index, std::size_t &end_index,
+     std::error_code &error_code) {
+
+  if (current_index >= end_index) {
+    // end of input
+    // return true for forward compatibility
+    return true;
+  }
+
+  // current byte is the size of the vector
+  std::size_t size = 0;
+  if (!read_length<O>(size, bytes, current_index, end_index, error_code)) {
+    return false;
+  }
+
+  if (size > end_index - current_index) {
+    // size is greater than the number of bytes remaining
+    error_code = std::make_error_code(std::errc::value_too_large);
+
+    // stop here
+    return false;
+  }
+
+  using value_type = typename T::value_type;
+  if constexpr (with_chunk_index<O>() &&
+                fixed_serialized_size<O, value_type>() == 0) {
+    if (size > vector_chunk_size) {
+      const auto num_chunks = num_vector_chunks(size);
+      if (num_chunks > (end_index - current_index) / chunk_size_bytes) {
+        // chunk sizes run past the end of the input
+        error_code = std::make_error_code(std::errc::value_too_large);
+        return false;
+      }
+      const auto table_index = current_index;
+      current_index += num_chunks * chunk_size_bytes;
+
+      // walk the chunk table in place, nothing is allocated
+      // each chunk has to end where its size says
+      for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+        const auto chunk_size = read_chunk_size<O>(
+            bytes, table_index + chunk * chunk_size_bytes);
+        if (chunk_size > end_index - current_index) {
+          // chunk runs past the end of the input
+          error_code = std::make_error_code(std::errc::value_too_large);
+          return false;
+        }
+        std::size_t chunk_end =
+            current_index + static_cast<std::size_t>(chunk_size);
+        const auto first = chunk * vector_chunk_size;
+        const auto last = std::min(first + vector_chunk_size, size);
+        for (std::size_t i = first; i < last; ++i) {
+          if (current_index >= chunk_end) {
+            // chunk ends before its elements do
+            error_code =
+                std::make_error_code(std::errc::illegal_byte_sequence);
+            return false;
+          }
+          if (!skip<O, value_type>(bytes, current_index, chunk_end,
+                                   error_code)) {
+            return false;
+          }
+        }
+        if (current_index != chunk_end) {
+          error_code = std::make_error_code(std::errc::illegal_byte_sequence);
+          return false;
+        }
+      }
+      return true;
+    }
+  }
+
+  // skip `size` values
+  for (std::size_t i = 0; i < size; ++i) {
+    if (!skip<O, value_type>(bytes, current_index, end_index, error_code)) {
+      return false;
+    }
+  }
+
+  return true;
+}
+
 } // namespace detail
 
 } // namespace alpaca
@@ -0,0 +1,136 @@
+#pragma once
+#include <alpaca/alpaca.h>
+#include <alpaca/detail/profile.h>
+#include <algorithm>
+#include <chrono>
+#include <iomanip>
+#include <ostream>
+#include <string>
+#include <system_error>
+#include <unordered_map>
+
+namespace alpaca {
+
+// Serializes and deserializes T (with N fields) like serialize<O, T, N> and
+// deserialize<O, T, N>, adding up the bytes and time of every field path
+// over all calls made through it, e.g.,
+//
+//   alpaca::profile<Player> profile;
+//   profile.serialize(player, bytes);
+//   auto result = profile.deserialize(bytes, error_code);
+//   profile.report(std::cout);
+//
+// The calls made through it are instantiated with an internal option, so
+// serialize and deserialize of the same types elsewhere in the program are
+// not instrumented and cost nothing extra
+//
+// A struct whose fields all have a fixed size is serialized in one piece,
+// so serialize reports it as a whole and not per field
+template <typename T, options O = options::none,
+          std::size_t N = detail::aggregate_arity<std::remove_cv_t<T>>::size(),
+          typename Container = std::vector<uint8_t>>
+class profile {
+  using clock = std::chrono::steady_clock;
+  static constexpr auto profiled = O | detail::profile_fields_flag;
+
+public:
+  std::size_t serialize(const T &s, Container &bytes) {
+    detail::profile_context context{entries_, index_, false,
+                                    std::string(detail::type_name<T>())};
+    detail::profile_context_scope scope(context);
+    auto &stats = context.stats(detail::type_name<T>());
+
+    const auto start = clock::now();
+    const auto size = alpaca::serialize<profiled, T, N, Container>(s, bytes);
+    stats.time += clock::now() - start;
+    stats.bytes += size;
+    ++stats.calls;
+    return size;
+  }
+
+  T deserialize(Container &bytes, std::error_code &error_code) {
+    return deserialize(bytes, bytes.size(), error_code);
+  }
+
+  T deserialize(Container &bytes, std::size_t size,
+                std::error_code &error_code) {
+    detail::profile_context context{entries_, index_, true,
+                                    std::string(detail::type_name<T>())};
+    detail::profile_context_scope scope(context);
+    auto &stats = context.stats(detail::type_name<T>());
+
+    const auto start = clock::now();
+    auto result = alpaca::deserialize<profiled, T, N, Container>(bytes, size,
+                                                                 error_code);
+    stats.time += clock::now() - start;
+    stats.bytes += size;
+    ++stats.calls;
+    return result;
+  }
+
+  // every field path seen so far, in the order first reached
+  // the first entry is the whole message
+  const std::deque<profile_entry> &entries() const { return entries_; }
+
+  void clear() {
+    entries_.clear();
+    index_.clear();
+  }
+
+  // one table for serialize and one for deserialize, with the bytes and
+  // time of each path as a share of the whole message
+  void report(std::ostream &os) const {
+    std::size_t width = 4;
+    for (const auto &entry : entries_) {
+      width = std::max(width, entry.path.size());
+    }
+
+    const auto flags = os.flags();
+    const auto precision = os.precision();
+    report(os, width, "serialize", &profile_entry::serialize);
+    report(os, width, "deserialize", &profile_entry::deserialize);
+    os.flags(flags);
+    os.precision(precision);
+  }
+
+private:
+  void report(std::ostream &os, std::size_t width, const char *name,
+              profile_stats profile_entry::*member) const {
+    if (entries_.empty() || (entries_.front().*member).calls == 0) {
+      return;
+    }
+    const auto &total = entries_.front().*member;
+    const auto path_width = static_cast<int>(width);
+
+    const auto percent = [](double part, double whole) {
+      return whole > 0 ? 100.0 * part / whole : 0.0;
+    };
+
+    os << name << "\n"
+       << std::left << std::setw(path_width) << "path" << std::right
+       << std::setw(10) << "calls" << std::setw(14) << "bytes"
+       << std::setw(8) << "%" << std::setw(14) << "ns" << std::setw(8) << "%"
+       << "  type\n";
+    os << std::fixed << std::setprecision(1);
+    for (const auto &entry : entries_) {
+      const auto &stats = entry.*member;
+      if (stats.calls == 0) {
+        continue;
+      }
+      os << std::left << std::setw(path_width) << entry.path << std::right
+         << std::setw(10) << stats.calls << std::setw(14) << stats.bytes
+         << std::setw(8)
+         << percent(static_cast<double>(stats.bytes),
+                    static_cast<double>(total.bytes))
+         << std::setw(14) << stats.time.count() << std::setw(8)
+         << percent(static_cast<double>(stats.time.count()),
+                    static_cast<double>(total.time.count()))
+         << "  " << entry.type << "\n";
+    }
+  }
+
+  std::deque<profile_entry> entries_;
+  std::unordered_map<std::string, std::size_t> index_;
+};
+
+} // namespace alpaca
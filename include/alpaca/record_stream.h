@@ -0,0 +1,314 @@
+#pragma once
+#include <alpaca/alpaca.h>
+#include <cstring>
+#include <istream>
+#include <iterator>
+#include <limits>
+#include <ostream>
+#include <system_error>
+#include <vector>
+
+namespace alpaca {
+
+// A record stream is a sequence of serialized T, each prefixed by its size:
+//
+//   size | record | size | record | ...
+//
+// where size is a varint (7 bits per byte, low bits first) and record is the
+// output of serialize<O, T, N>(). With options::with_checksum every record
+// carries its own CRC32, so a corrupt record is reported without losing the
+// records after it
+
+namespace detail {
+
+// a size takes at most 10 bytes as a varint
+constexpr std::size_t max_record_size_bytes = 10;
+
+constexpr std::size_t record_buffer_size = 64 * 1024;
+
+} // namespace detail
+
+// Appends records of T (with N fields) to a std::ostream, e.g., a
+// std::ofstream opened in binary mode
+// Records are buffered and written to the stream in blocks
+template <typename T, options O = options::none,
+          std::size_t N = detail::arity_or_zero<T>()>
+class record_writer {
+public:
+  explicit record_writer(std::ostream &stream,
+                         std::size_t buffer_size = detail::record_buffer_size)
+      : stream_(stream), buffer_size_(buffer_size) {
+    buffer_.reserve(buffer_size_);
+  }
+
+  // flushes, ignoring errors - call flush() to see them
+  ~record_writer() {
+    std::error_code error_code;
+    flush(error_code);
+  }
+
+  record_writer(const record_writer &) = delete;
+  record_writer &operator=(const record_writer &) = delete;
+
+  // Append one record
+  // Returns the number of bytes the record takes in the stream
+  std::size_t write(const T &record, std::error_code &error_code) {
+    record_.clear();
+    const auto size = serialize<O, T, N>(record, record_);
+
+    std::size_t index = buffer_.size();
+    const auto first = index;
+    detail::encode_varint_7<std::size_t>(size, buffer_, index);
+    const auto framed_size = index - first + size;
+
+    if (size > buffer_size_) {
+      // write what is buffered, then the record as is without copying it
+      write_buffer(error_code);
+      write_bytes(record_.data(), size, error_code);
+      return framed_size;
+    }
+
+    detail::append_bytes(record_.data(), size, buffer_, index);
+    if (buffer_.size() >= buffer_size_) {
+      write_buffer(error_code);
+    }
+    return framed_size;
+  }
+
+  // Write buffered records to the stream and flush it
+  void flush(std::error_code &error_code) {
+    write_buffer(error_code);
+    stream_.flush();
+    if (!stream_) {
+      error_code = std::make_error_code(std::errc::io_error);
+    }
+  }
+
+private:
+  void write_buffer(std::error_code &error_code) {
+    write_bytes(buffer_.data(), buffer_.size(), error_code);
+    buffer_.clear();
+  }
+
+  void write_bytes(const uint8_t *data, std::size_t size,
+                   std::error_code &error_code) {
+    if (size == 0) {
+      return;
+    }
+    stream_.write(reinterpret_cast<const char *>(data),
+                  static_cast<std::streamsize>(size));
+    if (!stream_) {
+      error_code = std::make_error_code(std::errc::io_error);
+    }
+  }
+
+  std::ostream &stream_;
+  std::size_t buffer_size_;
+  std::vector<uint8_t> buffer_;
+  std::vector<uint8_t> record_;
+};
+
+// Reads back the records of a record_writer from a std::istream
+// The stream is read in blocks into a buffer that is reused across records,
+// and every record is decoded straight out of that buffer
+template <typename T, options O = options::none,
+          std::size_t N = detail::arity_or_zero<T>()>
+class record_reader {
+public:
+  // records larger than `max_record_size` are rejected with
+  // std::errc::value_too_large instead of being buffered
+  explicit record_reader(std::istream &stream,
+                         std::size_t max_record_size = 64 * 1024 * 1024,
+                         std::size_t buffer_size = detail::record_buffer_size)
+      : stream_(stream), max_record_size_(max_record_size),
+        buffer_(std::max(buffer_size, detail::max_record_size_bytes)) {}
+
+  record_reader(const record_reader &) = delete;
+  record_reader &operator=(const record_reader &) = delete;
+
+  // Read the next record into `record`
+  // Returns false at the end of the stream, or on error with error_code set:
+  //   std::errc::message_size      the stream ends inside a record
+  //   std::errc::value_too_large   the record is larger than max_record_size
+  //   std::errc::io_error          reading the stream failed
+  //   anything deserialize() reports for the record itself
+  // After a record that is too large, or an error in the record itself,
+  // e.g., a checksum mismatch, the record is skipped and next() can be
+  // called again
+  bool next(T &record, std::error_code &error_code) {
+    std::size_t size = 0;
+    if (!read_size(size, error_code)) {
+      return false;
+    }
+
+    if (size > max_record_size_) {
+      // step over the record, so that the next size is read from after it
+      if (discard(size, error_code)) {
+        error_code = std::make_error_code(std::errc::value_too_large);
+      } else if (!error_code) {
+        error_code = std::make_error_code(std::errc::message_size);
+      }
+      return false;
+    }
+
+    if (!fill(size, error_code)) {
+      if (!error_code) {
+        error_code = std::make_error_code(std::errc::message_size);
+      }
+      return false;
+    }
+
+    const byte_span bytes(buffer_.data() + begin_, size);
+    begin_ += size;
+
+    record = T{};
+    std::size_t byte_index = 0;
+    std::size_t end_index = size;
+    deserialize<O, T, N>(record, bytes, byte_index, end_index, error_code);
+    return !error_code;
+  }
+
+  // The error that ended the iteration, if any
+  const std::error_code &error() const noexcept { return error_code_; }
+
+  // Input iterator over the records, for use in range-based for loops
+  // Iteration ends at the end of the stream or at the first error, see
+  // error()
+  class iterator {
+  public:
+    using iterator_category = std::input_iterator_tag;
+    using value_type = T;
+    using difference_type = std::ptrdiff_t;
+    using pointer = const T *;
+    using reference = const T &;
+
+    iterator() = default;
+
+    explicit iterator(record_reader *reader) : reader_(reader) { ++*this; }
+
+    reference operator*() const { return record_; }
+
+    pointer operator->() const { return &record_; }
+
+    iterator &operator++() {
+      if (!reader_->next(record_, reader_->error_code_)) {
+        reader_ = nullptr;
+      }
+      return *this;
+    }
+
+    bool operator==(const iterator &other) const {
+      return reader_ == other.reader_;
+    }
+
+    bool operator!=(const iterator &other) const { return !(*this == other); }
+
+  private:
+    record_reader *reader_{nullptr};
+    T record_{};
+  };
+
+  iterator begin() { return iterator(this); }
+
+  iterator end() { return iterator(); }
+
+private:
+  // decode the size of the next record
+  // returns false, without error, at the end of the stream
+  bool read_size(std::size_t &size, std::error_code &error_code) {
+    if (!fill(1, error_code)) {
+      return false;
+    }
+
+    fill(detail::max_record_size_bytes, error_code);
+    if (error_code) {
+      return false;
+    }
+
+    for (std::size_t i = 0; i < detail::max_record_size_bytes; ++i) {
+      if (begin_ + i == end_) {
+        // the stream ends inside the size
+        error_code = std::make_error_code(std::errc::message_size);
+        return false;
+      }
+      const auto byte = buffer_[begin_ + i];
+      size |= static_cast<std::size_t>(byte & 127) << (7 * i);
+      if (!(byte & 128)) {
+        begin_ += i + 1;
+        return true;
+      }
+    }
+
+    error_code = std::make_error_code(std::errc::illegal_byte_sequence);
+    return false;
+  }
+
+  // make at least `size` bytes available at begin_, reading from the stream
+  // as needed
+  // returns false if the stream ends first
+  bool fill(std::size_t size, std::error_code &error_code) {
+    if (end_ - begin_ >= size) {
+      return true;
+    }
+
+    // move what is left to the front
+    if (begin_ > 0) {
+      std::memmove(buffer_.data(), buffer_.data() + begin_, end_ - begin_);
+      end_ -= begin_;
+      begin_ = 0;
+    }
+
+    if (buffer_.size() < size) {
+      buffer_.resize(size);
+    }
+
+    while (end_ < size && !eof_) {
+      stream_.read(reinterpret_cast<char *>(buffer_.data() + end_),
+                   static_cast<std::streamsize>(buffer_.size() - end_));
+      end_ += static_cast<std::size_t>(stream_.gcount());
+      if (stream_.eof()) {
+        eof_ = true;
+      } else if (!stream_) {
+        error_code = std::make_error_code(std::errc::io_error);
+        return false;
+      }
+    }
+
+    return end_ >= size;
+  }
+
+  // drop the next `size` bytes without buffering them
+  // returns false if the stream ends first
+  bool discard(std::size_t size, std::error_code &error_code) {
+    const auto buffered = std::min(size, end_ - begin_);
+    begin_ += buffered;
+    size -= buffered;
+
+    while (size > 0 && !eof_) {
+      const auto count = std::min<std::size_t>(
+          size, static_cast<std::size_t>(
+                    std::numeric_limits<std::streamsize>::max()));
+      stream_.ignore(static_cast<std::streamsize>(count));
+      size -= static_cast<std::size_t>(stream_.gcount());
+      if (stream_.eof()) {
+        eof_ = true;
+      } else if (!stream_) {
+        error_code = std::make_error_code(std::errc::io_error);
+        return false;
+      }
+    }
+
+    return size == 0;
+  }
+
+  std::istream &stream_;
+  std::size_t max_record_size_;
+  std::vector<uint8_t> buffer_;
+  // unread bytes are buffer_[begin_, end_)
+  std::size_t begin_{0};
+  std::size_t end_{0};
+  bool eof_{false};
+  std::error_code error_code_{};
+};
+
+} // namespace alpaca
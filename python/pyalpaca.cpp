@@ -1,7 +1,80 @@
+#include "python_codec.h"
 #include "python_deserialize_helper.h"
 #include "python_serialize_helper.h"
 
 PYBIND11_MODULE(pyalpaca, m) {
   m.def("serialize", &alpaca::python::do_serialize);
   m.def("deserialize", &alpaca::python::do_deserialize);
-}
\ No newline at end of file
+
+  py::class_<alpaca::python::codec>(m, "Codec")
+      .def(py::init([](const std::string &format, bool numpy, bool big_endian,
+                       bool fixed_length_encoding, bool with_version,
+                       bool with_checksum, bool with_chunk_index) {
+             return alpaca::python::codec(
+                 format, numpy,
+                 alpaca::python::make_options(big_endian, fixed_length_encoding,
+                                              with_version, with_checksum,
+                                              with_chunk_index));
+           }),
+           py::arg("format"), py::arg("numpy") = false,
+           py::arg("big_endian") = false,
+           py::arg("fixed_length_encoding") = false,
+           py::arg("with_version") = false, py::arg("with_checksum") = false,
+           py::arg("with_chunk_index") = false)
+      .def_property_readonly("format", &alpaca::python::codec::format)
+      .def_property_readonly("numpy", &alpaca::python::codec::numpy)
+      .def_property_readonly("version", &alpaca::python::codec::version)
+      .def("pack", &alpaca::python::codec::pack, py::arg("values"))
+      .def("unpack", &alpaca::python::codec::unpack, py::arg("bytes"))
+      .def("pack_many", &alpaca::python::codec::pack_many,
+           py::arg("messages"), py::arg("threads") = 1)
+      .def("unpack_many", &alpaca::python::codec::unpack_many,
+           py::arg("buffers"), py::arg("threads") = 1)
+      .def("__repr__", [](const alpaca::python::codec &codec) {
+        std::string repr = "pyalpaca.Codec('" + codec.format() + "'";
+        if (codec.numpy()) {
+          repr += ", numpy=True";
+        }
+        const auto value = static_cast<int>(codec.get_options());
+        const std::pair<alpaca::options, const char *> flags[] = {
+            {alpaca::options::big_endian, "big_endian"},
+            {alpaca::options::fixed_length_encoding, "fixed_length_encoding"},
+            {alpaca::options::with_version, "with_version"},
+            {alpaca::options::with_checksum, "with_checksum"},
+            {alpaca::options::with_chunk_index, "with_chunk_index"}};
+        for (const auto &flag : flags) {
+          if (value & static_cast<int>(flag.first)) {
+            repr += std::string(", ") + flag.second + "=True";
+          }
+        }
+        return repr + ")";
+      });
+
+  m.def(
+      "compile",
+      [](const std::string &format, bool numpy, bool big_endian,
+         bool fixed_length_encoding, bool with_version, bool with_checksum,
+         bool with_chunk_index) {
+        return alpaca::python::codec(
+            format, numpy,
+            alpaca::python::make_options(big_endian, fixed_length_encoding,
+                                         with_version, with_checksum,
+                                         with_chunk_index));
+      },
+      py::arg("format"), py::arg("numpy") = false,
+      py::arg("big_endian") = false, py::arg("fixed_length_encoding") = false,
+      py::arg("with_version") = false, py::arg("with_checksum") = false,
+      py::arg("with_chunk_index") = false);
+
+  m.def(
+      "pack_many",
+      [](const alpaca::python::codec &codec, const py::sequence &messages,
+         std::size_t threads) { return codec.pack_many(messages, threads); },
+      py::arg("codec"), py::arg("messages"), py::arg("threads") = 1);
+
+  m.def(
+      "unpack_many",
+      [](const alpaca::python::codec &codec, const py::sequence &buffers,
+         std::size_t threads) { return codec.unpack_many(buffers, threads); },
+      py::arg("codec"), py::arg("buffers"), py::arg("threads") = 1);
+}
@@ -0,0 +1,39 @@
+#pragma once
+#include <alpaca/detail/byte_span.h>
+#include <pybind11/pybind11.h>
+
+namespace py = pybind11;
+
+namespace alpaca {
+
+namespace python {
+
+// The bytes of any object supporting the buffer protocol, e.g., bytes,
+// bytearray, memoryview or mmap, viewed in place without a copy
+// The object cannot be resized while the view exists
+class buffer_view {
+public:
+  explicit buffer_view(const py::buffer &buffer) {
+    // raises BufferError for non-contiguous memoryviews
+    if (PyObject_GetBuffer(buffer.ptr(), &view_, PyBUF_C_CONTIGUOUS) != 0) {
+      throw py::error_already_set();
+    }
+  }
+
+  buffer_view(const buffer_view &) = delete;
+  buffer_view &operator=(const buffer_view &) = delete;
+
+  ~buffer_view() { PyBuffer_Release(&view_); }
+
+  byte_span bytes() const {
+    return byte_span(static_cast<const uint8_t *>(view_.buf),
+                     static_cast<std::size_t>(view_.len));
+  }
+
+private:
+  Py_buffer view_;
+};
+
+} // namespace python
+
+} // namespace alpaca
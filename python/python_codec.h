@@ -0,0 +1,291 @@
+#pragma once
+#include "python_buffer.h"
+#include "python_format_plan.h"
+#include "python_tape.h"
+#include <alpaca/alpaca.h>
+#include <alpaca/detail/thread_pool.h>
+#include <memory>
+#include <pybind11/pybind11.h>
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace alpaca {
+
+namespace python {
+
+// Run f(0), ..., f(num_tasks - 1) on up to `num_threads` threads
+// Throws, for the first task that failed, its error prefixed with its index
+template <typename F>
+void run_batch(std::size_t num_tasks, std::size_t num_threads, F &&f) {
+  std::vector<std::string> errors(num_tasks);
+  std::vector<char> failed(num_tasks, false);
+  auto task = [&](std::size_t i) {
+    try {
+      f(i);
+    } catch (const std::exception &e) {
+      errors[i] = e.what();
+      failed[i] = true;
+    }
+  };
+
+  if (num_threads > 1 && num_tasks > 1) {
+    thread_pool pool(std::min(num_threads, num_tasks));
+    pool.execute(num_tasks, task);
+  } else {
+    inline_executor{}.execute(num_tasks, task);
+  }
+
+  for (std::size_t i = 0; i < num_tasks; ++i) {
+    if (failed[i]) {
+      throw std::runtime_error("Message " + std::to_string(i) + ": " +
+                               errors[i]);
+    }
+  }
+}
+
+// Calls f(std::integral_constant<options, O>{}) with O the options in `value`
+// that change how fields are encoded, so that each combination is compiled
+// ahead of time
+// with_version and with_checksum only add a header and a trailer, and are
+// handled by the codec itself
+template <typename F> void visit_encoding(options value, F &&f) {
+  constexpr auto big_endian = options::big_endian;
+  constexpr auto fixed_length = options::fixed_length_encoding;
+  constexpr auto chunk_index = options::with_chunk_index;
+
+  constexpr auto mask =
+      static_cast<int>(big_endian | fixed_length | chunk_index);
+  switch (static_cast<int>(value) & mask) {
+  case static_cast<int>(options::none):
+    return f(std::integral_constant<options, options::none>{});
+  case static_cast<int>(big_endian):
+    return f(std::integral_constant<options, big_endian>{});
+  case static_cast<int>(fixed_length):
+    return f(std::integral_constant<options, fixed_length>{});
+  case static_cast<int>(big_endian | fixed_length):
+    return f(std::integral_constant<options, big_endian | fixed_length>{});
+  case static_cast<int>(chunk_index):
+    return f(std::integral_constant<options, chunk_index>{});
+  case static_cast<int>(big_endian | chunk_index):
+    return f(std::integral_constant<options, big_endian | chunk_index>{});
+  case static_cast<int>(fixed_length | chunk_index):
+    return f(std::integral_constant<options, fixed_length | chunk_index>{});
+  default:
+    return f(std::integral_constant<options, big_endian | fixed_length |
+                                                 chunk_index>{});
+  }
+}
+
+inline options make_options(bool big_endian, bool fixed_length_encoding,
+                            bool with_version, bool with_checksum,
+                            bool with_chunk_index) {
+  int value = 0;
+  value |= big_endian ? static_cast<int>(options::big_endian) : 0;
+  value |= fixed_length_encoding
+               ? static_cast<int>(options::fixed_length_encoding)
+               : 0;
+  value |= with_version ? static_cast<int>(options::with_version) : 0;
+  value |= with_checksum ? static_cast<int>(options::with_checksum) : 0;
+  value |= with_chunk_index ? static_cast<int>(options::with_chunk_index) : 0;
+  return static_cast<options>(value);
+}
+
+// A format string compiled once, see pyalpaca.compile
+// pack and unpack walk the compiled fields instead of parsing the format
+// again on every call
+// With numpy, numeric vectors and arrays, e.g., [f] or [3i], are unpacked as
+// NumPy arrays instead of lists
+// The bytes are the same as alpaca::serialize<OPTIONS> writes for a struct
+// with one member per field
+class codec {
+public:
+  explicit codec(std::string format, bool numpy = false,
+                 options options = options::none)
+      : format_(std::move(format)), fields_(compile_format(format_)),
+        numpy_(numpy), options_(options), version_(format_version(fields_)) {}
+
+  const std::string &format() const { return format_; }
+
+  bool numpy() const { return numpy_; }
+
+  options get_options() const { return options_; }
+
+  // the type hash written with options::with_version
+  uint32_t version() const { return version_; }
+
+  py::bytes pack(const py::sequence &values) const {
+    value_tape tape;
+    collect(values, tape);
+    std::vector<uint8_t> bytes;
+    encode(tape, bytes);
+    return py::bytes(reinterpret_cast<const char *>(bytes.data()),
+                     bytes.size());
+  }
+
+  // input is any bytes-like object, read in place
+  py::list unpack(const py::buffer &input) const {
+    const buffer_view view(input);
+    value_tape tape;
+    decode(view.bytes(), tape);
+    return build(tape);
+  }
+
+  // pack every message in `messages`
+  // The values are collected with the GIL held, then encoded on up to
+  // `num_threads` threads without it
+  py::list pack_many(const py::sequence &messages,
+                     std::size_t num_threads) const {
+    const auto size = py::len(messages);
+    std::vector<value_tape> tapes(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      collect(py::reinterpret_borrow<py::sequence>(messages[i]), tapes[i]);
+    }
+
+    std::vector<std::vector<uint8_t>> outputs(size);
+    {
+      py::gil_scoped_release release;
+      run_batch(size, num_threads,
+                [&](std::size_t i) { encode(tapes[i], outputs[i]); });
+    }
+
+    py::list result(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      result[i] = py::bytes(reinterpret_cast<const char *>(outputs[i].data()),
+                            outputs[i].size());
+    }
+    return result;
+  }
+
+  // unpack every bytes-like object in `inputs`
+  // The messages are decoded on up to `num_threads` threads without the GIL,
+  // which is reacquired only to build the resulting lists
+  py::list unpack_many(const py::sequence &inputs,
+                       std::size_t num_threads) const {
+    const auto size = py::len(inputs);
+    std::vector<std::unique_ptr<buffer_view>> views;
+    views.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      views.push_back(std::make_unique<buffer_view>(
+          py::reinterpret_borrow<py::buffer>(inputs[i])));
+    }
+
+    std::vector<value_tape> tapes(size);
+    {
+      py::gil_scoped_release release;
+      run_batch(size, num_threads,
+                [&](std::size_t i) { decode(views[i]->bytes(), tapes[i]); });
+    }
+
+    py::list result(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      result[i] = build(tapes[i]);
+    }
+    return result;
+  }
+
+private:
+  // like serialize, an empty format has neither version nor checksum
+  bool has_option(options flag) const {
+    return !fields_.empty() &&
+           (static_cast<int>(options_) & static_cast<int>(flag)) != 0;
+  }
+
+  // GIL held
+  void collect(const py::sequence &values, value_tape &tape) const {
+    const auto size = py::len(values);
+    if (size != fields_.size()) {
+      throw std::runtime_error("Expected " + std::to_string(fields_.size()) +
+                               " values, instead found " +
+                               std::to_string(size));
+    }
+    for (std::size_t i = 0; i < fields_.size(); ++i) {
+      collect_node(fields_[i], values[i], tape);
+    }
+    tape.num_fields = fields_.size();
+  }
+
+  void encode(const value_tape &tape, std::vector<uint8_t> &bytes) const {
+    visit_encoding(options_, [&](auto encoding) {
+      constexpr auto O = decltype(encoding)::value;
+
+      std::size_t byte_index = 0;
+      if (has_option(options::with_version)) {
+        detail::to_bytes_crc32<O>(bytes, byte_index, version_);
+      }
+
+      tape_cursor cursor;
+      for (const auto &field : fields_) {
+        encode_node<O>(field, tape, cursor, bytes, byte_index);
+      }
+
+      if (has_option(options::with_checksum)) {
+        const uint32_t crc = crc32_fast(bytes.data(), byte_index);
+        detail::to_bytes_crc32<O>(bytes, byte_index, crc);
+      }
+    });
+  }
+
+  void decode(const byte_span &bytes, value_tape &tape) const {
+    visit_encoding(options_, [&](auto encoding) {
+      constexpr auto O = decltype(encoding)::value;
+
+      std::size_t byte_index = 0;
+      std::size_t end_index = bytes.size();
+      std::error_code error_code;
+
+      if (has_option(options::with_version)) {
+        uint32_t version = 0;
+        if (end_index < 4 ||
+            !detail::from_bytes_crc32<O>(version, bytes, byte_index,
+                                         end_index, error_code) ||
+            version != version_) {
+          throw std::runtime_error("Invalid version");
+        }
+      }
+
+      if (has_option(options::with_checksum)) {
+        // the checksum covers everything before it, version included
+        uint32_t crc = 0;
+        std::size_t crc_index = end_index - 4;
+        if (end_index - byte_index < 4 ||
+            !detail::from_bytes_crc32<O>(crc, bytes, crc_index, end_index,
+                                         error_code) ||
+            crc != crc32_fast(bytes.data(), end_index - 4)) {
+          throw std::runtime_error("Invalid checksum");
+        }
+        end_index -= 4;
+      }
+
+      // like deserialize, fields missing at the end of the input are left out
+      for (const auto &field : fields_) {
+        if (byte_index >= end_index) {
+          break;
+        }
+        decode_node<O>(field, bytes, byte_index, end_index, tape);
+        ++tape.num_fields;
+      }
+    });
+  }
+
+  // GIL held
+  py::list build(const value_tape &tape) const {
+    tape_cursor cursor;
+    py::list result(tape.num_fields);
+    for (std::size_t i = 0; i < tape.num_fields; ++i) {
+      result[i] = build_node(fields_[i], tape, cursor, numpy_);
+    }
+    return result;
+  }
+
+  std::string format_;
+  std::vector<format_node> fields_;
+  bool numpy_;
+  options options_;
+  uint32_t version_;
+};
+
+} // namespace python
+
+} // namespace alpaca
@@ -1,4 +1,5 @@
 #pragma once
+#include "python_buffer.h"
 #include "python_serialize_helper.h"
 
 namespace py = pybind11;
@@ -7,15 +8,13 @@ namespace alpaca {
 
 namespace python {
 
-py::list deserialize(const std::string &format,
-                     const std::vector<uint8_t> &bytes,
+py::list deserialize(const std::string &format, const byte_span &bytes,
                      std::size_t &byte_index);
 
 template <options OPTIONS, typename T>
-void load_simple_type(const std::vector<uint8_t> &bytes,
-                      std::size_t &byte_index, std::size_t &end_index,
-                      std::error_code &error_code, py::list &result,
-                      const std::string &type_name) {
+void load_simple_type(const byte_span &bytes, std::size_t &byte_index,
+                      std::size_t &end_index, std::error_code &error_code,
+                      py::list &result, const std::string &type_name) {
   T output{};
   detail::from_bytes_router<OPTIONS>(output, bytes, byte_index, end_index,
                                      error_code);
@@ -26,7 +25,7 @@ void load_simple_type(const std::vector<uint8_t> &bytes,
 }
 
 void load_array(const std::string &format, std::size_t &index,
-                const std::vector<uint8_t> &bytes, std::size_t &byte_index,
+                const byte_span &bytes, std::size_t &byte_index,
                 py::list &result) {
   // get past '['
   index++;
@@ -48,7 +47,7 @@ void load_array(const std::string &format, std::size_t &index,
 
 template <options OPTIONS>
 void load_vector(const std::string &format, std::size_t &index,
-                 const std::vector<uint8_t> &bytes, std::size_t &byte_index,
+                 const byte_span &bytes, std::size_t &byte_index,
                  std::size_t &end_index, py::list &result) {
   // field is a std::vector
 
@@ -78,9 +77,8 @@ void load_vector(const std::string &format, std::size_t &index,
 
 template <options OPTIONS>
 void load_unordered_map(const std::string &key_value_type,
-                        const std::vector<uint8_t> &bytes,
-                        std::size_t &byte_index, std::size_t &end_index,
-                        py::list &result) {
+                        const byte_span &bytes, std::size_t &byte_index,
+                        std::size_t &end_index, py::list &result) {
   // field is a std::unordered_map
 
   // load size
@@ -112,9 +110,8 @@ void load_unordered_map(const std::string &key_value_type,
 
 template <options OPTIONS>
 void load_unordered_set(const std::string &value_type,
-                        const std::vector<uint8_t> &bytes,
-                        std::size_t &byte_index, std::size_t &end_index,
-                        py::list &result) {
+                        const byte_span &bytes, std::size_t &byte_index,
+                        std::size_t &end_index, py::list &result) {
   // field is a std::unordered_set
 
   // load size
@@ -142,7 +139,7 @@ void load_unordered_set(const std::string &value_type,
 
 template <options OPTIONS>
 void load_tuple(const std::string &format, std::size_t &index,
-                const std::vector<uint8_t> &bytes, std::size_t &byte_index,
+                const byte_span &bytes, std::size_t &byte_index,
                 py::list &result) {
 
   auto value_type = get_value_type_tuple(format, index);
@@ -151,8 +148,7 @@ void load_tuple(const std::string &format, std::size_t &index,
       py::cast<py::tuple>(deserialize(value_type, bytes, byte_index)));
 }
 
-py::list deserialize(const std::string &format,
-                     const std::vector<uint8_t> &bytes,
+py::list deserialize(const std::string &format, const byte_span &bytes,
                      std::size_t &byte_index) {
   py::list result;
 
@@ -269,13 +265,10 @@ py::list deserialize(const std::string &format,
   return result;
 }
 
-py::list do_deserialize(const std::string &format, const py::bytes &bytes) {
-  std::vector<uint8_t> bytes_vector{};
+py::list do_deserialize(const std::string &format, const py::buffer &input) {
+  const buffer_view view(input);
   std::size_t byte_index = 0;
-  for (const auto &b : bytes) {
-    bytes_vector.push_back(py::cast<uint8_t>(b));
-  }
-  return deserialize(format, bytes_vector, byte_index);
+  return deserialize(format, view.bytes(), byte_index);
 }
 
 } // namespace python
@@ -0,0 +1,421 @@
+#pragma once
+#include <alpaca/detail/crc32.h>
+#include <alpaca/detail/field_type.h>
+#include <algorithm>
+#include <cctype>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+namespace alpaca {
+
+namespace python {
+
+// The type of one field of a format string
+enum class opcode : uint8_t {
+  boolean,   // ?
+  character, // c
+  int8,      // b
+  uint8,     // B
+  int16,     // h
+  uint16,    // H
+  int32,     // i
+  uint32,    // I
+  int64,     // q
+  uint64,    // Q
+  float32,   // f
+  float64,   // d
+  size,      // N
+  string,    // s
+  vector,    // [T]
+  array,     // [NT]
+  map,       // {K:V}
+  set,       // {T}
+  tuple      // (T...)
+};
+
+// A field of a format string, parsed once by compile_format
+struct format_node {
+  opcode op;
+
+  // number of elements, for arrays
+  std::size_t size{0};
+
+  // element type of vectors, arrays and sets, key and value type of maps,
+  // and field types of tuples
+  std::vector<format_node> children;
+};
+
+// The C++ type of a field, for error messages
+inline const char *opcode_type_name(opcode op) {
+  switch (op) {
+  case opcode::boolean:
+    return "bool";
+  case opcode::character:
+    return "char";
+  case opcode::int8:
+    return "int8_t";
+  case opcode::uint8:
+    return "uint8_t";
+  case opcode::int16:
+    return "int16_t";
+  case opcode::uint16:
+    return "uint16_t";
+  case opcode::int32:
+    return "int32_t";
+  case opcode::uint32:
+    return "uint32_t";
+  case opcode::int64:
+    return "int64_t";
+  case opcode::uint64:
+    return "uint64_t";
+  case opcode::float32:
+    return "float";
+  case opcode::float64:
+    return "double";
+  case opcode::size:
+    return "std::size_t";
+  case opcode::string:
+    return "std::string";
+  case opcode::vector:
+    return "vector";
+  case opcode::array:
+    return "array";
+  case opcode::map:
+    return "map";
+  case opcode::set:
+    return "set";
+  case opcode::tuple:
+    return "tuple";
+  }
+  return "";
+}
+
+inline bool scalar_opcode(char c, opcode &op) {
+  switch (c) {
+  case '?':
+    op = opcode::boolean;
+    return true;
+  case 'c':
+    op = opcode::character;
+    return true;
+  case 'b':
+    op = opcode::int8;
+    return true;
+  case 'B':
+    op = opcode::uint8;
+    return true;
+  case 'h':
+    op = opcode::int16;
+    return true;
+  case 'H':
+    op = opcode::uint16;
+    return true;
+  case 'i':
+    op = opcode::int32;
+    return true;
+  case 'I':
+    op = opcode::uint32;
+    return true;
+  case 'q':
+    op = opcode::int64;
+    return true;
+  case 'Q':
+    op = opcode::uint64;
+    return true;
+  case 'f':
+    op = opcode::float32;
+    return true;
+  case 'd':
+    op = opcode::float64;
+    return true;
+  case 'N':
+    op = opcode::size;
+    return true;
+  case 's':
+    op = opcode::string;
+    return true;
+  default:
+    return false;
+  }
+}
+
+[[noreturn]] inline void format_error(const std::string &format,
+                                      std::size_t index,
+                                      const std::string &expected) {
+  const auto found = index < format.size()
+                         ? "'" + std::string(1, format[index]) + "'"
+                         : std::string("end of format");
+  throw std::runtime_error("Expected " + expected + ", instead got " + found +
+                           " at position " + std::to_string(index) +
+                           " in format '" + format + "'");
+}
+
+// spaces and commas may separate fields, e.g., "(i, f)"
+inline void skip_separators(const std::string &format, std::size_t &index) {
+  while (index < format.size() &&
+         (format[index] == ' ' || format[index] == ',')) {
+    ++index;
+  }
+}
+
+inline void expect(const std::string &format, std::size_t &index, char c) {
+  skip_separators(format, index);
+  if (index >= format.size() || format[index] != c) {
+    format_error(format, index, "'" + std::string(1, c) + "'");
+  }
+  ++index;
+}
+
+inline format_node parse_format_field(const std::string &format,
+                                      std::size_t &index) {
+  skip_separators(format, index);
+  if (index >= format.size()) {
+    format_error(format, index, "type");
+  }
+
+  format_node node{};
+  const auto c = format[index++];
+
+  if (scalar_opcode(c, node.op)) {
+    return node;
+  }
+
+  if (c == '[') {
+    // array if the element type starts with its size
+    if (index < format.size() && std::isdigit(format[index])) {
+      node.op = opcode::array;
+      while (index < format.size() && std::isdigit(format[index])) {
+        node.size =
+            node.size * 10 + static_cast<std::size_t>(format[index++] - '0');
+      }
+    } else {
+      node.op = opcode::vector;
+    }
+    node.children.push_back(parse_format_field(format, index));
+    expect(format, index, ']');
+  } else if (c == '{') {
+    // map if the key type is followed by ':'
+    node.children.push_back(parse_format_field(format, index));
+    skip_separators(format, index);
+    if (index < format.size() && format[index] == ':') {
+      ++index;
+      node.op = opcode::map;
+      node.children.push_back(parse_format_field(format, index));
+    } else {
+      node.op = opcode::set;
+    }
+    expect(format, index, '}');
+  } else if (c == '(') {
+    node.op = opcode::tuple;
+    skip_separators(format, index);
+    while (index < format.size() && format[index] != ')') {
+      node.children.push_back(parse_format_field(format, index));
+      skip_separators(format, index);
+    }
+    if (node.children.empty()) {
+      format_error(format, index, "type");
+    }
+    expect(format, index, ')');
+  } else {
+    format_error(format, index - 1, "type");
+  }
+
+  return node;
+}
+
+// Parse a format string, e.g., "?cifs[i]{c:i}", into one node per field
+// Throws std::runtime_error if the format is not valid
+inline std::vector<format_node> compile_format(const std::string &format) {
+  std::vector<format_node> fields;
+  std::size_t index = 0;
+  skip_separators(format, index);
+  while (index < format.size()) {
+    fields.push_back(parse_format_field(format, index));
+    skip_separators(format, index);
+  }
+  return fields;
+}
+
+// Size and alignment of the C++ type of a field
+struct field_layout {
+  std::size_t size;
+  std::size_t align;
+};
+
+template <typename T> constexpr field_layout layout_of() {
+  return {sizeof(T), alignof(T)};
+}
+
+inline field_layout format_field_layout(const format_node &node);
+
+// Layout of a struct with one member per field, in order
+template <typename It> field_layout struct_layout(It first, It last) {
+  std::size_t size = 0;
+  std::size_t align = 1;
+  for (; first != last; ++first) {
+    const auto field = format_field_layout(*first);
+    size = (size + field.align - 1) / field.align * field.align + field.size;
+    align = std::max(align, field.align);
+  }
+  return {(size + align - 1) / align * align, align};
+}
+
+// Layout of the C++ type a field maps to, e.g., std::vector<T> for [T], with
+// the standard library this module is compiled with
+inline field_layout format_field_layout(const format_node &node) {
+  switch (node.op) {
+  case opcode::boolean:
+    return layout_of<bool>();
+  case opcode::character:
+    return layout_of<char>();
+  case opcode::int8:
+    return layout_of<int8_t>();
+  case opcode::uint8:
+    return layout_of<uint8_t>();
+  case opcode::int16:
+    return layout_of<int16_t>();
+  case opcode::uint16:
+    return layout_of<uint16_t>();
+  case opcode::int32:
+    return layout_of<int32_t>();
+  case opcode::uint32:
+    return layout_of<uint32_t>();
+  case opcode::int64:
+    return layout_of<int64_t>();
+  case opcode::uint64:
+    return layout_of<uint64_t>();
+  case opcode::float32:
+    return layout_of<float>();
+  case opcode::float64:
+    return layout_of<double>();
+  case opcode::size:
+    return layout_of<std::size_t>();
+  case opcode::string:
+    return layout_of<std::string>();
+  case opcode::vector:
+    return layout_of<std::vector<uint8_t>>();
+  case opcode::array: {
+    const auto element = format_field_layout(node.children[0]);
+    return {node.size * element.size, element.align};
+  }
+  case opcode::map:
+    return layout_of<std::unordered_map<uint8_t, uint8_t>>();
+  case opcode::set:
+    return layout_of<std::unordered_set<uint8_t>>();
+  case opcode::tuple:
+#if defined(_LIBCPP_VERSION)
+    // libc++ stores the elements of a std::tuple in order
+    return struct_layout(node.children.begin(), node.children.end());
+#else
+    // libstdc++ and MSVC store them in reverse order
+    return struct_layout(node.children.rbegin(), node.children.rend());
+#endif
+  }
+  return {0, 1};
+}
+
+// Same as alpaca::detail::type_info for the C++ type of a field
+inline void format_type_info(const format_node &node,
+                             std::vector<uint8_t> &typeids) {
+  using detail::field_type;
+  using detail::to_byte;
+
+  switch (node.op) {
+  case opcode::boolean:
+    typeids.push_back(to_byte<field_type::bool_>());
+    return;
+  case opcode::character:
+    typeids.push_back(to_byte<field_type::char_>());
+    return;
+  case opcode::int8:
+    typeids.push_back(to_byte<field_type::int8>());
+    return;
+  case opcode::uint8:
+    typeids.push_back(to_byte<field_type::uint8>());
+    return;
+  case opcode::int16:
+    typeids.push_back(to_byte<field_type::int16>());
+    return;
+  case opcode::uint16:
+    typeids.push_back(to_byte<field_type::uint16>());
+    return;
+  case opcode::int32:
+    typeids.push_back(to_byte<field_type::int32>());
+    return;
+  case opcode::uint32:
+    typeids.push_back(to_byte<field_type::uint32>());
+    return;
+  case opcode::int64:
+    typeids.push_back(to_byte<field_type::int64>());
+    return;
+  case opcode::uint64:
+    typeids.push_back(to_byte<field_type::uint64>());
+    return;
+  case opcode::float32:
+    typeids.push_back(to_byte<field_type::float32>());
+    return;
+  case opcode::float64:
+    typeids.push_back(to_byte<field_type::float64>());
+    return;
+  case opcode::size:
+    typeids.push_back(sizeof(std::size_t) == sizeof(uint64_t)
+                          ? to_byte<field_type::uint64>()
+                          : to_byte<field_type::uint32>());
+    return;
+  case opcode::string:
+    typeids.push_back(to_byte<field_type::string>());
+    return;
+  case opcode::vector:
+    typeids.push_back(to_byte<field_type::vector>());
+    format_type_info(node.children[0], typeids);
+    return;
+  case opcode::array:
+    typeids.push_back(to_byte<field_type::array>());
+    typeids.push_back(static_cast<uint8_t>(node.size));
+    format_type_info(node.children[0], typeids);
+    return;
+  case opcode::map:
+    typeids.push_back(to_byte<field_type::unordered_map>());
+    format_type_info(node.children[0], typeids);
+    format_type_info(node.children[1], typeids);
+    return;
+  case opcode::set:
+    typeids.push_back(to_byte<field_type::unordered_set>());
+    format_type_info(node.children[0], typeids);
+    return;
+  case opcode::tuple:
+    typeids.push_back(to_byte<field_type::tuple>());
+    for (const auto &child : node.children) {
+      format_type_info(child, typeids);
+    }
+    return;
+  }
+}
+
+// The version that options::with_version writes for a struct with one member
+// per field, i.e., the crc32 of its type_info
+inline uint32_t format_version(const std::vector<format_node> &fields) {
+  std::vector<uint8_t> typeids;
+
+  // number of fields and size of the struct, as little endian uint16_t
+  const auto layout = struct_layout(fields.begin(), fields.end());
+  for (const auto value : {static_cast<uint16_t>(fields.size()),
+                           static_cast<uint16_t>(layout.size)}) {
+    typeids.push_back(static_cast<uint8_t>(value & 0xff));
+    typeids.push_back(static_cast<uint8_t>(value >> 8));
+  }
+
+  for (const auto &field : fields) {
+    format_type_info(field, typeids);
+  }
+  return crc32_fast(typeids.data(), typeids.size());
+}
+
+} // namespace python
+
+} // namespace alpaca
@@ -422,12 +422,8 @@ py::list do_serialize_list(const std::string &format, const py::list &args) {
 }
 
 py::bytes do_serialize(const std::string &format, const py::list &args) {
-  auto bytes = serialize(format, args);
-  std::string bytestring{""};
-  for (const auto &b : bytes) {
-    bytestring += static_cast<char>(b);
-  }
-  return py::bytes(bytestring);
+  const auto bytes = serialize(format, args);
+  return py::bytes(reinterpret_cast<const char *>(bytes.data()), bytes.size());
 }
 
 } // namespace python
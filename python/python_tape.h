@@ -0,0 +1,659 @@
+#pragma once
+#include "python_format_plan.h"
+#include <alpaca/alpaca.h>
+#include <cstring>
+#include <pybind11/numpy.h>
+#include <pybind11/pybind11.h>
+#include <string>
+#include <vector>
+
+namespace py = pybind11;
+
+namespace alpaca {
+
+namespace python {
+
+// Calls f(T{}) with the C++ type of a numeric opcode, i.e., the element types
+// with a NumPy equivalent
+// Returns false for every other opcode
+template <typename F> bool visit_numeric(opcode op, F &&f) {
+  switch (op) {
+  case opcode::int8:
+    f(int8_t{});
+    return true;
+  case opcode::uint8:
+    f(uint8_t{});
+    return true;
+  case opcode::int16:
+    f(int16_t{});
+    return true;
+  case opcode::uint16:
+    f(uint16_t{});
+    return true;
+  case opcode::int32:
+    f(int32_t{});
+    return true;
+  case opcode::uint32:
+    f(uint32_t{});
+    return true;
+  case opcode::int64:
+    f(int64_t{});
+    return true;
+  case opcode::uint64:
+    f(uint64_t{});
+    return true;
+  case opcode::float32:
+    f(float{});
+    return true;
+  case opcode::float64:
+    f(double{});
+    return true;
+  case opcode::size:
+    f(std::size_t{});
+    return true;
+  default:
+    return false;
+  }
+}
+
+// Like visit_numeric, for every opcode except strings and containers
+template <typename F> bool visit_scalar(opcode op, F &&f) {
+  switch (op) {
+  case opcode::boolean:
+    f(bool{});
+    return true;
+  case opcode::character:
+    f(char{});
+    return true;
+  default:
+    return visit_numeric(op, f);
+  }
+}
+
+// Serialized size of a field under OPTIONS if it is the same for every value,
+// otherwise 0, see alpaca::detail::fixed_serialized_size
+template <options OPTIONS> std::size_t fixed_size(const format_node &node) {
+  std::size_t size = 0;
+  if (visit_scalar(node.op, [&](auto element) {
+        size = detail::fixed_serialized_size<OPTIONS, decltype(element)>();
+      })) {
+    return size;
+  }
+  if (node.op == opcode::array) {
+    return node.size * fixed_size<OPTIONS>(node.children[0]);
+  }
+  return 0;
+}
+
+// true if the elements of a vector of `size` elements are preceded by a
+// chunk index, see alpaca/detail/chunk_index.h
+template <options OPTIONS>
+bool has_chunk_index(const format_node &node, std::size_t size) {
+  if constexpr (detail::with_chunk_index<OPTIONS>()) {
+    return node.op == opcode::vector && size > detail::vector_chunk_size &&
+           fixed_size<OPTIONS>(node.children[0]) == 0;
+  } else {
+    return false;
+  }
+}
+
+// No value can be a NumPy array unless numpy has been imported
+// Checked first so that packing never imports numpy itself
+inline bool numpy_imported() {
+  return PyDict_GetItemString(PyImport_GetModuleDict(), "numpy") != nullptr;
+}
+
+// A bool, char or number, or the size of a vector, map or set
+union scalar {
+  bool boolean;
+  char character;
+  int64_t integer;
+  uint64_t unsigned_integer;
+  double floating_point;
+};
+
+template <typename T> scalar to_scalar(T value) {
+  scalar result{};
+  if constexpr (std::is_same_v<T, bool>) {
+    result.boolean = value;
+  } else if constexpr (std::is_same_v<T, char>) {
+    result.character = value;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    result.floating_point = value;
+  } else if constexpr (std::is_signed_v<T>) {
+    result.integer = value;
+  } else {
+    result.unsigned_integer = value;
+  }
+  return result;
+}
+
+template <typename T> T from_scalar(const scalar &value) {
+  if constexpr (std::is_same_v<T, bool>) {
+    return value.boolean;
+  } else if constexpr (std::is_same_v<T, char>) {
+    return value.character;
+  } else if constexpr (std::is_floating_point_v<T>) {
+    return static_cast<T>(value.floating_point);
+  } else if constexpr (std::is_signed_v<T>) {
+    return static_cast<T>(value.integer);
+  } else {
+    return static_cast<T>(value.unsigned_integer);
+  }
+}
+
+// The elements of a numeric vector or array, laid out as in memory
+struct numeric_run {
+  // into the input or a NumPy array, or nullptr if the elements are in
+  // value_tape::storage at `offset`
+  const uint8_t *data;
+  std::size_t offset;
+  std::size_t size;
+};
+
+// The values of one message, without Python objects, in the order the format
+// visits them
+// pack collects Python values into a tape and then encodes it, and unpack
+// decodes into a tape and then builds Python values from it, so that encoding
+// and decoding can run without the GIL
+struct value_tape {
+  std::vector<scalar> scalars;
+  std::vector<std::string> strings;
+  std::vector<numeric_run> runs;
+  std::vector<uint8_t> storage;
+
+  // top-level fields, fewer than in the format if the input ends early
+  std::size_t num_fields{0};
+
+  // NumPy arrays that runs point into
+  // The tape must be destroyed with the GIL held
+  std::vector<py::object> arrays;
+
+  const uint8_t *run_data(const numeric_run &run) const {
+    return run.data ? run.data : storage.data() + run.offset;
+  }
+};
+
+// read position in a value_tape
+struct tape_cursor {
+  std::size_t scalar{0};
+  std::size_t string{0};
+  std::size_t run{0};
+};
+
+inline void check_array_size(const format_node &node, std::size_t size) {
+  // No need to serialize the size of arrays, so it must match
+  if (node.op == opcode::array && size != node.size) {
+    throw std::runtime_error("Expected " + std::to_string(node.size) +
+                             " values, instead found " + std::to_string(size));
+  }
+}
+
+// Collect a numeric vector or array
+// A one-dimensional NumPy array is referenced as is, if it converts to T
+// without loss of precision, e.g., int32 to int64 but not float to int
+// Anything else, e.g., a list, is converted element by element
+template <typename T>
+void collect_numeric_run(const format_node &node, py::handle value,
+                         value_tape &tape) {
+  if (numpy_imported() && py::isinstance<py::array>(value)) {
+    auto array = py::array_t<T, py::array::c_style>::ensure(value);
+    if (array && array.ndim() == 1) {
+      const auto size = static_cast<std::size_t>(array.size());
+      check_array_size(node, size);
+      tape.runs.push_back(
+          {reinterpret_cast<const uint8_t *>(array.data()), 0, size});
+      tape.arrays.push_back(std::move(array));
+      return;
+    }
+  }
+
+  const auto size = py::len(value);
+  check_array_size(node, size);
+  const auto offset = tape.storage.size();
+  tape.storage.resize(offset + size * sizeof(T));
+  std::size_t i = 0;
+  for (auto item : py::reinterpret_borrow<py::iterable>(value)) {
+    const auto element = item.cast<T>();
+    std::memcpy(tape.storage.data() + offset + i++ * sizeof(T), &element,
+                sizeof(T));
+  }
+  tape.runs.push_back({nullptr, offset, size});
+}
+
+// GIL held
+inline void collect_node(const format_node &node, py::handle value,
+                         value_tape &tape) {
+  if (visit_scalar(node.op, [&](auto element) {
+        tape.scalars.push_back(to_scalar(value.cast<decltype(element)>()));
+      })) {
+    return;
+  }
+
+  switch (node.op) {
+  case opcode::string:
+    tape.strings.push_back(value.cast<std::string>());
+    return;
+  case opcode::vector:
+  case opcode::array: {
+    if (visit_numeric(node.children[0].op, [&](auto element) {
+          collect_numeric_run<decltype(element)>(node, value, tape);
+        })) {
+      return;
+    }
+    const auto size = py::len(value);
+    check_array_size(node, size);
+    if (node.op == opcode::vector) {
+      tape.scalars.push_back(to_scalar(size));
+    }
+    for (auto item : py::reinterpret_borrow<py::iterable>(value)) {
+      collect_node(node.children[0], item, tape);
+    }
+    return;
+  }
+  case opcode::map: {
+    const auto dict = py::reinterpret_borrow<py::dict>(value);
+    tape.scalars.push_back(to_scalar(py::len(dict)));
+    for (auto item : dict) {
+      collect_node(node.children[0], item.first, tape);
+      collect_node(node.children[1], item.second, tape);
+    }
+    return;
+  }
+  case opcode::set:
+    tape.scalars.push_back(to_scalar(py::len(value)));
+    for (auto item : py::reinterpret_borrow<py::iterable>(value)) {
+      collect_node(node.children[0], item, tape);
+    }
+    return;
+  case opcode::tuple: {
+    const auto size = py::len(value);
+    if (size != node.children.size()) {
+      throw std::runtime_error("Expected " +
+                               std::to_string(node.children.size()) +
+                               " values, instead found " +
+                               std::to_string(size));
+    }
+    std::size_t i = 0;
+    for (auto item : py::reinterpret_borrow<py::iterable>(value)) {
+      collect_node(node.children[i++], item, tape);
+    }
+    return;
+  }
+  default:
+    return;
+  }
+}
+
+// Encode the elements of a numeric vector or array
+// Copied at once if their serialized layout matches the layout in memory,
+// and encoded one by one otherwise, e.g., as varints
+template <options OPTIONS, typename T>
+void encode_numeric_run(const uint8_t *data, std::size_t size,
+                        std::vector<uint8_t> &bytes, std::size_t &byte_index) {
+  if constexpr (detail::has_serialized_layout<OPTIONS, T>()) {
+    if (size > 0) {
+      detail::append_bytes(data, size * sizeof(T), bytes, byte_index);
+    }
+  } else {
+    for (std::size_t i = 0; i < size; ++i) {
+      T element;
+      std::memcpy(&element, data + i * sizeof(T), sizeof(T));
+      detail::to_bytes_router<OPTIONS>(element, bytes, byte_index);
+    }
+  }
+}
+
+// Encode the size of a vector, then its elements with encode(first, last)
+// chunk by chunk if it has a chunk index
+// Only the elements are encoded for arrays
+template <options OPTIONS, typename F>
+void encode_elements(const format_node &node, std::size_t size,
+                     std::vector<uint8_t> &bytes, std::size_t &byte_index,
+                     F &&encode) {
+  if (node.op == opcode::vector) {
+    detail::to_bytes_router<OPTIONS>(size, bytes, byte_index);
+  }
+
+  if (!has_chunk_index<OPTIONS>(node, size)) {
+    encode(std::size_t{0}, size);
+    return;
+  }
+
+  // leave room for the chunk sizes, filled in once each chunk is written
+  const auto num_chunks = detail::num_vector_chunks(size);
+  const auto table_index = byte_index;
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    detail::write_chunk_size<OPTIONS>(0, bytes, byte_index);
+  }
+
+  for (std::size_t chunk = 0; chunk < num_chunks; ++chunk) {
+    const auto start = byte_index;
+    const auto first = chunk * detail::vector_chunk_size;
+    encode(first, std::min(first + detail::vector_chunk_size, size));
+    detail::patch_chunk_size<OPTIONS>(byte_index - start, bytes,
+                                      table_index +
+                                          chunk * detail::chunk_size_bytes);
+  }
+}
+
+// No Python objects are used, so the GIL need not be held
+template <options OPTIONS>
+void encode_node(const format_node &node, const value_tape &tape,
+                 tape_cursor &cursor, std::vector<uint8_t> &bytes,
+                 std::size_t &byte_index) {
+  if (visit_scalar(node.op, [&](auto element) {
+        detail::to_bytes_router<OPTIONS>(
+            from_scalar<decltype(element)>(tape.scalars[cursor.scalar++]),
+            bytes, byte_index);
+      })) {
+    return;
+  }
+
+  switch (node.op) {
+  case opcode::string:
+    detail::to_bytes_router<OPTIONS>(tape.strings[cursor.string++], bytes,
+                                     byte_index);
+    return;
+  case opcode::vector:
+  case opcode::array: {
+    if (visit_numeric(node.children[0].op, [&](auto element) {
+          using T = decltype(element);
+          const auto &run = tape.runs[cursor.run++];
+          const auto *data = tape.run_data(run);
+          encode_elements<OPTIONS>(
+              node, run.size, bytes, byte_index,
+              [&](std::size_t first, std::size_t last) {
+                encode_numeric_run<OPTIONS, T>(data + first * sizeof(T),
+                                               last - first, bytes,
+                                               byte_index);
+              });
+        })) {
+      return;
+    }
+    const auto size =
+        node.op == opcode::array
+            ? node.size
+            : from_scalar<std::size_t>(tape.scalars[cursor.scalar++]);
+    encode_elements<OPTIONS>(
+        node, size, bytes, byte_index,
+        [&](std::size_t first, std::size_t last) {
+          for (std::size_t i = first; i < last; ++i) {
+            encode_node<OPTIONS>(node.children[0], tape, cursor, bytes,
+                                 byte_index);
+          }
+        });
+    return;
+  }
+  case opcode::map: {
+    const auto size = from_scalar<std::size_t>(tape.scalars[cursor.scalar++]);
+    detail::to_bytes_router<OPTIONS>(size, bytes, byte_index);
+    for (std::size_t i = 0; i < size; ++i) {
+      encode_node<OPTIONS>(node.children[0], tape, cursor, bytes, byte_index);
+      encode_node<OPTIONS>(node.children[1], tape, cursor, bytes, byte_index);
+    }
+    return;
+  }
+  case opcode::set: {
+    const auto size = from_scalar<std::size_t>(tape.scalars[cursor.scalar++]);
+    detail::to_bytes_router<OPTIONS>(size, bytes, byte_index);
+    for (std::size_t i = 0; i < size; ++i) {
+      encode_node<OPTIONS>(node.children[0], tape, cursor, bytes, byte_index);
+    }
+    return;
+  }
+  case opcode::tuple:
+    for (const auto &child : node.children) {
+      encode_node<OPTIONS>(child, tape, cursor, bytes, byte_index);
+    }
+    return;
+  default:
+    return;
+  }
+}
+
+// read the size of a vector, map or set
+template <options OPTIONS>
+std::size_t decode_size(const byte_span &bytes, std::size_t &byte_index,
+                        std::size_t &end_index, const char *type_name) {
+  std::error_code error_code;
+  std::size_t size = 0;
+  detail::from_bytes_router<OPTIONS>(size, bytes, byte_index, end_index,
+                                     error_code);
+  if (error_code || size > end_index - byte_index) {
+    // size is greater than the number of bytes remaining
+    throw std::runtime_error(std::string("Invalid ") + type_name + " size");
+  }
+  return size;
+}
+
+// Decode the `size` elements of a numeric vector or array
+// Referenced in the input if their serialized layout matches the layout in
+// memory, and decoded one by one into the tape otherwise, e.g., varints
+template <options OPTIONS, typename T>
+void decode_numeric_run(std::size_t size, const byte_span &bytes,
+                        std::size_t &byte_index, std::size_t &end_index,
+                        const char *type_name, value_tape &tape) {
+  if constexpr (detail::has_serialized_layout<OPTIONS, T>()) {
+    if (size > (end_index - byte_index) / sizeof(T)) {
+      throw std::runtime_error(std::string("Error parsing ") + type_name);
+    }
+    tape.runs.push_back({bytes.data() + byte_index, 0, size});
+    byte_index += size * sizeof(T);
+  } else {
+    const auto offset = tape.storage.size();
+    tape.storage.resize(offset + size * sizeof(T));
+    std::error_code error_code;
+    for (std::size_t i = 0; i < size; ++i) {
+      T element{};
+      detail::from_bytes_router<OPTIONS>(element, bytes, byte_index,
+                                         end_index, error_code);
+      if (error_code) {
+        throw std::runtime_error(std::string("Error parsing ") + type_name);
+      }
+      std::memcpy(tape.storage.data() + offset + i * sizeof(T), &element,
+                  sizeof(T));
+    }
+    tape.runs.push_back({nullptr, offset, size});
+  }
+}
+
+// Decode the elements of a vector or array with decode(), after skipping the
+// chunk index of a vector that has one
+template <options OPTIONS, typename F>
+void decode_elements(const format_node &node, std::size_t size,
+                     const byte_span &bytes, std::size_t &byte_index,
+                     std::size_t &end_index, F &&decode) {
+  if (!has_chunk_index<OPTIONS>(node, size)) {
+    decode();
+    return;
+  }
+
+  std::vector<std::size_t> starts;
+  std::error_code error_code;
+  if (!detail::read_vector_chunks<OPTIONS>(starts, size, bytes, byte_index,
+                                           end_index, error_code)) {
+    throw std::runtime_error("Invalid chunk index");
+  }
+  const auto end = byte_index + starts.back();
+  decode();
+  if (byte_index != end) {
+    // chunk sizes do not match the elements
+    throw std::runtime_error("Invalid chunk index");
+  }
+}
+
+// No Python objects are used, so the GIL need not be held
+template <options OPTIONS>
+void decode_node(const format_node &node, const byte_span &bytes,
+                 std::size_t &byte_index, std::size_t &end_index,
+                 value_tape &tape) {
+  if (visit_scalar(node.op, [&](auto element) {
+        std::error_code error_code;
+        detail::from_bytes_router<OPTIONS>(element, bytes, byte_index,
+                                           end_index, error_code);
+        if (error_code) {
+          throw std::runtime_error(std::string("Error parsing ") +
+                                   opcode_type_name(node.op));
+        }
+        tape.scalars.push_back(to_scalar(element));
+      })) {
+    return;
+  }
+
+  switch (node.op) {
+  case opcode::string: {
+    std::string value;
+    std::error_code error_code;
+    detail::from_bytes_router<OPTIONS>(value, bytes, byte_index, end_index,
+                                       error_code);
+    if (error_code) {
+      throw std::runtime_error("Error parsing std::string");
+    }
+    tape.strings.push_back(std::move(value));
+    return;
+  }
+  case opcode::vector:
+  case opcode::array: {
+    const auto size =
+        node.op == opcode::array
+            ? node.size
+            : decode_size<OPTIONS>(bytes, byte_index, end_index, "vector");
+    const auto &child = node.children[0];
+    if (visit_numeric(child.op, [&](auto element) {
+          decode_elements<OPTIONS>(
+              node, size, bytes, byte_index, end_index, [&] {
+                decode_numeric_run<OPTIONS, decltype(element)>(
+                    size, bytes, byte_index, end_index,
+                    opcode_type_name(child.op), tape);
+              });
+        })) {
+      return;
+    }
+    if (node.op == opcode::vector) {
+      tape.scalars.push_back(to_scalar(size));
+    }
+    decode_elements<OPTIONS>(node, size, bytes, byte_index, end_index, [&] {
+      for (std::size_t i = 0; i < size; ++i) {
+        decode_node<OPTIONS>(child, bytes, byte_index, end_index, tape);
+      }
+    });
+    return;
+  }
+  case opcode::map: {
+    const auto size = decode_size<OPTIONS>(bytes, byte_index, end_index, "map");
+    tape.scalars.push_back(to_scalar(size));
+    for (std::size_t i = 0; i < size; ++i) {
+      decode_node<OPTIONS>(node.children[0], bytes, byte_index, end_index,
+                           tape);
+      decode_node<OPTIONS>(node.children[1], bytes, byte_index, end_index,
+                           tape);
+    }
+    return;
+  }
+  case opcode::set: {
+    const auto size = decode_size<OPTIONS>(bytes, byte_index, end_index, "set");
+    tape.scalars.push_back(to_scalar(size));
+    for (std::size_t i = 0; i < size; ++i) {
+      decode_node<OPTIONS>(node.children[0], bytes, byte_index, end_index,
+                           tape);
+    }
+    return;
+  }
+  case opcode::tuple:
+    for (const auto &child : node.children) {
+      decode_node<OPTIONS>(child, bytes, byte_index, end_index, tape);
+    }
+    return;
+  default:
+    return;
+  }
+}
+
+// Build a NumPy array, or a list, from the elements of a numeric run
+template <typename T>
+py::object build_numeric_run(const value_tape &tape, const numeric_run &run,
+                             bool numpy) {
+  const auto *data = tape.run_data(run);
+  if (numpy) {
+    py::array_t<T> array(static_cast<py::ssize_t>(run.size));
+    if (run.size > 0) {
+      std::memcpy(array.mutable_data(), data, run.size * sizeof(T));
+    }
+    return std::move(array);
+  }
+
+  py::list list(run.size);
+  for (std::size_t i = 0; i < run.size; ++i) {
+    T element;
+    std::memcpy(&element, data + i * sizeof(T), sizeof(T));
+    list[i] = py::cast(element);
+  }
+  return std::move(list);
+}
+
+// GIL held
+// With numpy, numeric vectors and arrays are built as NumPy arrays
+inline py::object build_node(const format_node &node, const value_tape &tape,
+                             tape_cursor &cursor, bool numpy) {
+  py::object result;
+  if (visit_scalar(node.op, [&](auto element) {
+        result = py::cast(
+            from_scalar<decltype(element)>(tape.scalars[cursor.scalar++]));
+      })) {
+    return result;
+  }
+
+  switch (node.op) {
+  case opcode::string:
+    return py::cast(tape.strings[cursor.string++]);
+  case opcode::vector:
+  case opcode::array: {
+    if (visit_numeric(node.children[0].op, [&](auto element) {
+          result = build_numeric_run<decltype(element)>(
+              tape, tape.runs[cursor.run++], numpy);
+        })) {
+      return result;
+    }
+    const auto size =
+        node.op == opcode::array
+            ? node.size
+            : from_scalar<std::size_t>(tape.scalars[cursor.scalar++]);
+    py::list list(size);
+    for (std::size_t i = 0; i < size; ++i) {
+      list[i] = build_node(node.children[0], tape, cursor, numpy);
+    }
+    return std::move(list);
+  }
+  case opcode::map: {
+    const auto size = from_scalar<std::size_t>(tape.scalars[cursor.scalar++]);
+    py::dict dict;
+    for (std::size_t i = 0; i < size; ++i) {
+      auto key = build_node(node.children[0], tape, cursor, numpy);
+      dict[key] = build_node(node.children[1], tape, cursor, numpy);
+    }
+    return std::move(dict);
+  }
+  case opcode::set: {
+    const auto size = from_scalar<std::size_t>(tape.scalars[cursor.scalar++]);
+    py::set set;
+    for (std::size_t i = 0; i < size; ++i) {
+      set.add(build_node(node.children[0], tape, cursor, numpy));
+    }
+    return std::move(set);
+  }
+  case opcode::tuple: {
+    py::tuple tuple(node.children.size());
+    for (std::size_t i = 0; i < node.children.size(); ++i) {
+      tuple[i] = build_node(node.children[i], tape, cursor, numpy);
+    }
+    return std::move(tuple);
+  }
+  default:
+    return py::none();
+  }
+}
+
+} // namespace python
+
+} // namespace alpaca
@@ -0,0 +1,45 @@
+#include <alpaca/record_stream.h>
+#include <cassert>
+#include <fstream>
+using namespace alpaca;
+
+struct Event {
+  uint64_t timestamp;
+  std::string name;
+  std::vector<int> values;
+};
+
+int main() {
+
+  const auto filename = "events.bin";
+
+  {
+    // Append events to the log
+    std::ofstream os;
+    os.open(filename, std::ios::out | std::ios::binary);
+    record_writer<Event, options::with_checksum> writer(os);
+
+    std::error_code ec;
+    for (uint64_t i = 0; i < 1000; ++i) {
+      writer.write(Event{i, "tick", {1, 2, 3}}, ec);
+    }
+    writer.flush(ec);
+    assert(!ec);
+  }
+
+  {
+    // Replay the log, no file size needed
+    std::ifstream is;
+    is.open(filename, std::ios::in | std::ios::binary);
+    record_reader<Event, options::with_checksum> reader(is);
+
+    uint64_t expected = 0;
+    for (const auto &event : reader) {
+      assert(event.timestamp == expected);
+      assert(event.name == "tick");
+      ++expected;
+    }
+    assert(!reader.error());
+    assert(expected == 1000);
+  }
+}
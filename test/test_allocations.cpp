@@ -0,0 +1,126 @@
+#include <alpaca/alpaca.h>
+#include <allocation_counter.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+// Budgets for the heap allocations of serialize and deserialize, counted by
+// benchmark/allocation_counter.cpp, so that extra temporaries show up here
+
+namespace test_allocations {
+template <typename F> std::size_t count_allocations(F &&f) {
+  const auto start = alpaca::benchmark::allocation_totals().allocations;
+  f();
+  return alpaca::benchmark::allocation_totals().allocations - start;
+}
+
+struct scalars {
+  uint32_t a;
+  float b;
+  bool c;
+  int64_t d;
+};
+} // namespace test_allocations
+
+TEST_CASE("Serialize without allocating" * test_suite("allocations")) {
+  using namespace test_allocations;
+
+  struct my_struct {
+    scalars s;
+    std::string name;
+    std::vector<std::string> tags;
+    std::map<int, int> m;
+  };
+  my_struct s{{1, 2.0f, true, -5}, std::string(40, 'a'), {}, {}};
+  for (int i = 0; i < 100; ++i) {
+    s.tags.push_back(std::string(40, 'b'));
+    s.m[i] = i;
+  }
+
+  std::array<uint8_t, 1 << 16> array;
+  REQUIRE(count_allocations([&] { serialize(s, array); }) == 0);
+
+  std::vector<uint8_t> bytes;
+  bytes.reserve(1 << 16);
+  REQUIRE(count_allocations([&] { serialize(s, bytes); }) == 0);
+  REQUIRE(count_allocations([&] {
+            bytes.clear();
+            serialize<options::fixed_length_encoding | options::big_endian |
+                      options::with_checksum>(s, bytes);
+          }) == 0);
+}
+
+TEST_CASE("Deserialize with one allocation per heap object" *
+          test_suite("allocations")) {
+  using namespace test_allocations;
+
+  std::vector<uint8_t> bytes;
+  std::error_code ec;
+
+  SUBCASE("scalars") {
+    serialize(scalars{1, 2.0f, true, -5}, bytes);
+    REQUIRE(count_allocations([&] { deserialize<scalars>(bytes, ec); }) == 0);
+  }
+
+  SUBCASE("vector of ints") {
+    struct my_struct {
+      std::vector<int> v;
+    };
+    my_struct s{};
+    for (int i = 0; i < 1000; ++i) {
+      s.v.push_back(i * 1000);
+    }
+    serialize(s, bytes);
+    REQUIRE(count_allocations([&] { deserialize<my_struct>(bytes, ec); }) == 1);
+  }
+
+  SUBCASE("vector of structs") {
+    struct my_struct {
+      std::vector<scalars> v;
+    };
+    my_struct s{std::vector<scalars>(100, scalars{1, 2.0f, true, -5})};
+    serialize(s, bytes);
+    REQUIRE(count_allocations([&] { deserialize<my_struct>(bytes, ec); }) == 1);
+  }
+
+  SUBCASE("vector of strings") {
+    struct my_struct {
+      std::vector<std::string> v;
+    };
+    // longer than the small string buffer
+    my_struct s{std::vector<std::string>(100, std::string(40, 'a'))};
+    serialize(s, bytes);
+    REQUIRE(count_allocations([&] { deserialize<my_struct>(bytes, ec); }) ==
+            101);
+  }
+
+  SUBCASE("map") {
+    struct my_struct {
+      std::map<int, int> m;
+    };
+    my_struct s{};
+    for (int i = 0; i < 100; ++i) {
+      s.m[i] = i;
+    }
+    serialize(s, bytes);
+    REQUIRE(count_allocations([&] { deserialize<my_struct>(bytes, ec); }) ==
+            100);
+  }
+
+  SUBCASE("unique_ptr") {
+    struct my_struct {
+      std::unique_ptr<int> p;
+    };
+    my_struct s{std::make_unique<int>(5)};
+    serialize(s, bytes);
+    // keep the result, or new/delete may be elided
+    my_struct result{};
+    REQUIRE(count_allocations([&] {
+              result = deserialize<my_struct>(bytes, ec);
+            }) == 1);
+    REQUIRE(*result.p == 5);
+  }
+
+  REQUIRE((bool)ec == false);
+}
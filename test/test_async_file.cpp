@@ -0,0 +1,129 @@
+#include <alpaca/async_file.h>
+#include <doctest.hpp>
+#include <filesystem>
+
+#if defined(__unix__) || defined(__APPLE__)
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_async_file {
+struct snapshot {
+  uint64_t tick;
+  std::string world;
+  std::vector<uint32_t> entities;
+};
+
+snapshot make_snapshot(uint64_t tick, std::size_t size) {
+  snapshot s{tick, "world " + std::to_string(tick), {}};
+  s.entities.resize(size);
+  for (std::size_t i = 0; i < size; ++i) {
+    s.entities[i] = static_cast<uint32_t>(i * tick);
+  }
+  return s;
+}
+
+snapshot load(const std::string &path) {
+  std::ifstream is(path, std::ios::in | std::ios::binary);
+  std::vector<uint8_t> bytes(std::istreambuf_iterator<char>(is), {});
+  std::error_code ec;
+  auto s = deserialize<snapshot>(bytes, ec);
+  REQUIRE((bool)ec == false);
+  return s;
+}
+
+void check_saves(async_file_writer &writer) {
+  const std::string paths[] = {"tmp_async_file_1.bin", "tmp_async_file_2.bin",
+                               "tmp_async_file_3.bin"};
+
+  std::vector<std::future<std::error_code>> results;
+  for (uint64_t tick = 0; tick < 3; ++tick) {
+    // the last snapshot is large enough to take several writes
+    const std::size_t size = tick == 2 ? 1 << 20 : 1000;
+    results.push_back(writer.save(make_snapshot(tick, size), paths[tick]));
+  }
+
+  for (uint64_t tick = 0; tick < 3; ++tick) {
+    REQUIRE((bool)results[tick].get() == false);
+    const auto s = load(paths[tick]);
+    const auto expected = make_snapshot(tick, tick == 2 ? 1 << 20 : 1000);
+    REQUIRE(s.tick == expected.tick);
+    REQUIRE(s.world == expected.world);
+    REQUIRE(s.entities == expected.entities);
+    std::filesystem::remove(paths[tick]);
+  }
+}
+} // namespace test_async_file
+
+TEST_CASE("Async file writer" * test_suite("async_file")) {
+  async_file_writer writer;
+  test_async_file::check_saves(writer);
+  // the writer can be reused
+  test_async_file::check_saves(writer);
+}
+
+TEST_CASE("Async file writer with pwrite" * test_suite("async_file")) {
+  async_file_writer writer(false);
+  REQUIRE(writer.uses_io_uring() == false);
+  test_async_file::check_saves(writer);
+}
+
+TEST_CASE("Async file writer replaces the file" * test_suite("async_file")) {
+  using namespace test_async_file;
+  const auto path = "tmp_async_file_4.bin";
+
+  async_file_writer writer;
+  REQUIRE(writer.save(make_snapshot(1, 5000), path).get().value() == 0);
+  REQUIRE(writer.save(make_snapshot(2, 10), path).get().value() == 0);
+
+  const auto s = load(path);
+  REQUIRE(s.tick == 2);
+  REQUIRE(s.entities.size() == 10);
+  std::filesystem::remove(path);
+
+  // no temporary file is left behind
+  for (const auto &entry : std::filesystem::directory_iterator(".")) {
+    REQUIRE(entry.path().filename().string().rfind(
+                "tmp_async_file_4.bin.tmp", 0) == std::string::npos);
+  }
+}
+
+TEST_CASE("Async file writer keeps the previous file on error" *
+          test_suite("async_file")) {
+  using namespace test_async_file;
+  const std::string path = "tmp_async_file_6.bin";
+
+  async_file_writer writer;
+  REQUIRE((bool)writer.save(make_snapshot(1, 5000), path).get() == false);
+
+  // the temporary files cannot be created
+  std::filesystem::create_directory(path + ".tmp0");
+  std::filesystem::create_directory(path + ".tmp1");
+  REQUIRE((bool)writer.save(make_snapshot(2, 10), path).get() == true);
+
+  const auto s = load(path);
+  REQUIRE(s.tick == 1);
+  REQUIRE(s.entities.size() == 5000);
+  std::filesystem::remove(path + ".tmp0");
+  std::filesystem::remove(path + ".tmp1");
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Async file writer errors" * test_suite("async_file")) {
+  using namespace test_async_file;
+
+  for (bool use_io_uring : {true, false}) {
+    async_file_writer writer(use_io_uring);
+    auto result =
+        writer.save(make_snapshot(1, 10), "no_such_directory/snapshot.bin");
+    REQUIRE(result.get() == std::errc::no_such_file_or_directory);
+
+    // and the writer keeps working
+    const auto path = "tmp_async_file_5.bin";
+    REQUIRE((bool)writer.save(make_snapshot(2, 10), path).get() == false);
+    REQUIRE(load(path).tick == 2);
+    std::filesystem::remove(path);
+  }
+}
+
+#endif
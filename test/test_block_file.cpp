@@ -0,0 +1,310 @@
+#include <alpaca/block_file.h>
+#include <doctest.hpp>
+#include <filesystem>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_block_file {
+struct event {
+  uint64_t timestamp;
+  std::string name;
+  std::vector<int> values;
+};
+
+// timestamps 0, 10, 20, ...
+void write_events(block_writer<event> &writer, std::size_t count) {
+  std::error_code ec;
+  for (std::size_t i = 0; i < count; ++i) {
+    writer.write(event{i * 10, "event " + std::to_string(i),
+                       std::vector<int>(i % 5, static_cast<int>(i))},
+                 i * 10, ec);
+  }
+  REQUIRE((bool)ec == false);
+}
+
+void check_event(const event &e, std::size_t i) {
+  REQUIRE(e.timestamp == i * 10);
+  REQUIRE(e.name == "event " + std::to_string(i));
+  REQUIRE(e.values.size() == i % 5);
+}
+
+std::string read_file(const std::string &path) {
+  std::ifstream is(path, std::ios::in | std::ios::binary);
+  return std::string(std::istreambuf_iterator<char>(is), {});
+}
+
+void write_file(const std::string &path, const std::string &bytes) {
+  std::ofstream os(path, std::ios::out | std::ios::binary);
+  os.write(bytes.data(), static_cast<std::streamsize>(bytes.size()));
+}
+} // namespace test_block_file
+
+TEST_CASE("Block file round trip" * test_suite("block_file")) {
+  using namespace test_block_file;
+  const auto path = "tmp_block_file_1.bin";
+  constexpr std::size_t count = 10000;
+
+  {
+    block_writer<event> writer(4096);
+    std::error_code ec;
+    REQUIRE(writer.open(path, ec));
+    write_events(writer, count);
+    writer.close(ec);
+    REQUIRE((bool)ec == false);
+  }
+
+  block_reader<event> reader;
+  std::error_code ec;
+  REQUIRE(reader.open(path, ec));
+  REQUIRE(reader.recovered() == false);
+  REQUIRE(reader.size() == count);
+  REQUIRE(reader.num_blocks() > 10);
+
+  event e;
+  std::size_t i = 0;
+  while (reader.next(e, ec)) {
+    check_event(e, i);
+    REQUIRE(reader.key() == i * 10);
+    ++i;
+  }
+  REQUIRE((bool)ec == false);
+  REQUIRE(i == count);
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Block file seek" * test_suite("block_file")) {
+  using namespace test_block_file;
+  const auto path = "tmp_block_file_2.bin";
+  constexpr std::size_t count = 5000;
+
+  {
+    block_writer<event> writer(1024);
+    std::error_code ec;
+    REQUIRE(writer.open(path, ec));
+    write_events(writer, count);
+  } // closed on destruction
+
+  block_reader<event> reader;
+  std::error_code ec;
+  REQUIRE(reader.open(path, ec));
+
+  event e;
+  for (std::size_t n : {0, 1, 17, 1234, 2500, 4998}) {
+    REQUIRE(reader.seek(n, ec));
+    REQUIRE(reader.next(e, ec));
+    check_event(e, n);
+    REQUIRE(reader.next(e, ec));
+    check_event(e, n + 1);
+  }
+
+  REQUIRE(reader.seek(count, ec));
+  REQUIRE(reader.next(e, ec) == false);
+  REQUIRE((bool)ec == false);
+
+  REQUIRE(reader.seek(count + 1, ec) == false);
+  REQUIRE(ec == std::errc::result_out_of_range);
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Block file seek key" * test_suite("block_file")) {
+  using namespace test_block_file;
+  const auto path = "tmp_block_file_3.bin";
+  constexpr std::size_t count = 5000;
+
+  {
+    block_writer<event> writer(1024);
+    std::error_code ec;
+    REQUIRE(writer.open(path, ec));
+    write_events(writer, count);
+  }
+
+  block_reader<event> reader;
+  std::error_code ec;
+  REQUIRE(reader.open(path, ec));
+
+  event e;
+  // exact keys, keys between records, and the first key
+  for (uint64_t key : {0, 10, 15, 12340, 12341, 25000, 49990}) {
+    REQUIRE(reader.seek_key(key, ec));
+    REQUIRE(reader.next(e, ec));
+    check_event(e, static_cast<std::size_t>((key + 9) / 10));
+  }
+
+  // past the last key
+  REQUIRE(reader.seek_key(49991, ec));
+  REQUIRE(reader.next(e, ec) == false);
+  REQUIRE((bool)ec == false);
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Block file keys must not decrease" * test_suite("block_file")) {
+  using namespace test_block_file;
+  const auto path = "tmp_block_file_4.bin";
+
+  block_writer<event> writer;
+  std::error_code ec;
+  REQUIRE(writer.open(path, ec));
+  writer.write(event{}, 5, ec);
+  writer.write(event{}, 5, ec);
+  REQUIRE((bool)ec == false);
+  writer.write(event{}, 4, ec);
+  REQUIRE(ec == std::errc::invalid_argument);
+  REQUIRE(writer.size() == 2);
+  writer.close(ec);
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Block file record too large" * test_suite("block_file")) {
+  using namespace test_block_file;
+  const auto path = "tmp_block_file_7.bin";
+  std::error_code ec;
+
+  {
+    block_writer<event> writer(4096, 100);
+    REQUIRE(writer.open(path, ec));
+    write_events(writer, 5);
+
+    writer.write(event{50, std::string(1000, 'x'), {}}, 50, ec);
+    REQUIRE(ec == std::errc::value_too_large);
+    REQUIRE(writer.size() == 5);
+
+    // the rejected record is not written, the writer goes on
+    ec.clear();
+    for (std::size_t i = 5; i < 10; ++i) {
+      writer.write(event{i * 10, "event " + std::to_string(i),
+                         std::vector<int>(i % 5, static_cast<int>(i))},
+                   i * 10, ec);
+    }
+    writer.close(ec);
+    REQUIRE((bool)ec == false);
+  }
+
+  block_reader<event> reader;
+  REQUIRE(reader.open(path, ec));
+  REQUIRE(reader.recovered() == false);
+  REQUIRE(reader.size() == 10);
+
+  event e;
+  std::size_t i = 0;
+  while (reader.next(e, ec)) {
+    check_event(e, i);
+    ++i;
+  }
+  REQUIRE((bool)ec == false);
+  REQUIRE(i == 10);
+
+  std::filesystem::remove(path);
+}
+
+TEST_CASE("Block file recovery" * test_suite("block_file")) {
+  using namespace test_block_file;
+  const auto path = "tmp_block_file_5.bin";
+  const auto crashed_path = "tmp_block_file_5_crashed.bin";
+
+  std::string flushed;
+  std::size_t flushed_count = 0;
+  {
+    block_writer<event> writer(1024);
+    std::error_code ec;
+    REQUIRE(writer.open(path, ec));
+    write_events(writer, 3000);
+    writer.flush(ec);
+    REQUIRE((bool)ec == false);
+
+    // the file as it is on disk if the writer crashes now
+    flushed = read_file(path);
+    flushed_count = writer.size();
+  }
+
+  SUBCASE("not closed") {
+    write_file(crashed_path, flushed);
+
+    block_reader<event> reader;
+    std::error_code ec;
+    REQUIRE(reader.open(crashed_path, ec));
+    REQUIRE(reader.recovered());
+    REQUIRE(reader.size() == flushed_count);
+
+    event e;
+    REQUIRE(reader.seek_key(20000, ec));
+    REQUIRE(reader.next(e, ec));
+    check_event(e, 2000);
+  }
+
+  SUBCASE("last block torn") {
+    write_file(crashed_path, flushed.substr(0, flushed.size() - 100));
+
+    block_reader<event> reader;
+    std::error_code ec;
+    REQUIRE(reader.open(crashed_path, ec));
+    REQUIRE(reader.recovered());
+    REQUIRE(reader.size() < flushed_count);
+    REQUIRE(reader.size() > 0);
+
+    // everything before the torn block is intact
+    event e;
+    std::size_t i = 0;
+    while (reader.next(e, ec)) {
+      check_event(e, i);
+      ++i;
+    }
+    REQUIRE((bool)ec == false);
+    REQUIRE(i == reader.size());
+  }
+
+  SUBCASE("last block corrupt") {
+    auto bytes = flushed;
+    bytes[bytes.size() - 10] ^= 0xff;
+    write_file(crashed_path, bytes);
+
+    block_reader<event> reader;
+    std::error_code ec;
+    REQUIRE(reader.open(crashed_path, ec));
+    REQUIRE(reader.recovered());
+    REQUIRE(reader.size() < flushed_count);
+  }
+
+  std::filesystem::remove(path);
+  std::filesystem::remove(crashed_path);
+}
+
+TEST_CASE("Block file errors" * test_suite("block_file")) {
+  using namespace test_block_file;
+  const auto path = "tmp_block_file_6.bin";
+
+  block_reader<event> reader;
+  std::error_code ec;
+  REQUIRE(reader.open("tmp_block_file_missing.bin", ec) == false);
+  REQUIRE(ec == std::errc::no_such_file_or_directory);
+
+  // not a block file
+  write_file(path, "hello world");
+  ec.clear();
+  REQUIRE(reader.open(path, ec) == false);
+  REQUIRE(ec == std::errc::invalid_argument);
+
+  // a corrupt block
+  ec.clear();
+  {
+    block_writer<event> writer;
+    REQUIRE(writer.open(path, ec));
+    write_events(writer, 10);
+  }
+  auto bytes = read_file(path);
+  bytes[detail::block_file_header_size + detail::block_header_size + 5] ^=
+      0xff;
+  write_file(path, bytes);
+
+  ec.clear();
+  REQUIRE(reader.open(path, ec));
+  event e;
+  REQUIRE(reader.next(e, ec) == false);
+  REQUIRE(ec == std::errc::bad_message);
+
+  std::filesystem::remove(path);
+}
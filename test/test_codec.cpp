@@ -0,0 +1,92 @@
+#include "test_codec.h"
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_codec {
+player make_player() {
+  return player{"steve",
+                42,
+                {{"sword", 1}, {"torch", 64}},
+                {{"hp", {20.0f, 18.5f}}, {"xp", {}}},
+                std::string{"online"}};
+}
+
+void require_equal(const player &lhs, const player &rhs) {
+  REQUIRE(lhs.name == rhs.name);
+  REQUIRE(lhs.level == rhs.level);
+  REQUIRE(lhs.inventory == rhs.inventory);
+  REQUIRE(lhs.stats == rhs.stats);
+  REQUIRE(lhs.status == rhs.status);
+}
+} // namespace test_codec
+
+TEST_CASE("Serialize and deserialize with extern codec" * test_suite("codec")) {
+  using namespace test_codec;
+  auto p = make_player();
+
+  std::vector<uint8_t> bytes;
+  auto bytes_written = codec<player>::serialize(p, bytes);
+  REQUIRE(bytes_written == bytes.size());
+
+  // the bytes alpaca::serialize writes, spelled out so that nothing in this
+  // file instantiates the header-only path for player
+  const std::vector<uint8_t> expected{
+      0x05, 's',  't',  'e',  'v',  'e',              // name
+      0x2a,                                           // level
+      0x02,                                           // inventory
+      0x05, 's',  'w',  'o',  'r',  'd',  0x01, 0x00, //
+      0x05, 't',  'o',  'r',  'c',  'h',  0x40, 0x00, //
+      0x02,                                           // stats
+      0x02, 'h',  'p',  0x02, 0x00, 0x00, 0xa0, 0x41, // 20.0f
+      0x00, 0x00, 0x94, 0x41,                         // 18.5f
+      0x02, 'x',  'p',  0x00,                         //
+      0x02, 0x06, 'o',  'n',  'l',  'i',  'n',  'e',  // status
+  };
+  REQUIRE(bytes == expected);
+
+  std::error_code ec;
+  auto recovered = codec<player>::deserialize(bytes, ec);
+  REQUIRE((bool)ec == false);
+  require_equal(recovered, p);
+
+  ec.clear();
+  recovered = codec<player>::deserialize(bytes, bytes.size(), ec);
+  REQUIRE((bool)ec == false);
+  require_equal(recovered, p);
+}
+
+TEST_CASE("Extern codec with options" * test_suite("codec")) {
+  using namespace test_codec;
+  constexpr auto OPTIONS = options::with_version | options::with_checksum;
+  using player_codec = codec<player, OPTIONS>;
+  auto p = make_player();
+
+  std::vector<uint8_t> bytes;
+  player_codec::serialize(p, bytes);
+
+  {
+    std::error_code ec;
+    auto recovered = player_codec::deserialize(bytes, ec);
+    REQUIRE((bool)ec == false);
+    require_equal(recovered, p);
+  }
+
+  {
+    // inventory has 2 elements
+    decode_limits limits;
+    limits.max_elements = 1;
+
+    std::error_code ec;
+    player_codec::deserialize(bytes, limits, ec);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::value_too_large));
+  }
+
+  {
+    bytes[8] ^= 0x01;
+    std::error_code ec;
+    player_codec::deserialize(bytes, ec);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::bad_message));
+  }
+}
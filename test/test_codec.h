@@ -0,0 +1,18 @@
+#pragma once
+#include <alpaca/alpaca.h>
+
+namespace test_codec {
+struct player {
+  std::string name;
+  uint32_t level;
+  std::vector<std::pair<std::string, uint16_t>> inventory;
+  std::map<std::string, std::vector<float>> stats;
+  std::variant<bool, double, std::string> status;
+};
+} // namespace test_codec
+
+// instantiated in test_codec_instantiation.cpp
+ALPACA_DECLARE_CODEC(test_codec::player);
+ALPACA_DECLARE_CODEC(test_codec::player,
+                     alpaca::options::with_version |
+                         alpaca::options::with_checksum);
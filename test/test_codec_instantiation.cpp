@@ -0,0 +1,6 @@
+#include "test_codec.h"
+
+ALPACA_DEFINE_CODEC(test_codec::player);
+ALPACA_DEFINE_CODEC(test_codec::player,
+                    alpaca::options::with_version |
+                        alpaca::options::with_checksum);
@@ -0,0 +1,86 @@
+#include <alpaca/batch.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_batch {
+struct message {
+  uint64_t id;
+  std::string text;
+  std::vector<int> values;
+};
+
+std::vector<std::vector<uint8_t>> make_frames(std::size_t count) {
+  std::vector<std::vector<uint8_t>> frames(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    message m{i, "message " + std::to_string(i),
+              std::vector<int>(i % 10, static_cast<int>(i))};
+    serialize(m, frames[i]);
+  }
+  return frames;
+}
+
+template <typename Executor> void check_batch(Executor &executor) {
+  constexpr std::size_t count = 1000;
+  auto frames = make_frames(count);
+
+  std::vector<message> output(count);
+  auto error_codes =
+      deserialize_batch<message>(frames, output.begin(), executor);
+
+  REQUIRE(error_codes.size() == count);
+  for (std::size_t i = 0; i < count; ++i) {
+    REQUIRE((bool)error_codes[i] == false);
+    REQUIRE(output[i].id == i);
+    REQUIRE(output[i].text == "message " + std::to_string(i));
+    REQUIRE(output[i].values.size() == i % 10);
+  }
+}
+} // namespace test_batch
+
+TEST_CASE("Deserialize batch inline" * test_suite("batch")) {
+  inline_executor executor;
+  test_batch::check_batch(executor);
+}
+
+TEST_CASE("Deserialize batch on thread pool" * test_suite("batch")) {
+  thread_pool pool(4);
+  REQUIRE(pool.concurrency() == 4);
+
+  // the pool can be reused
+  test_batch::check_batch(pool);
+  test_batch::check_batch(pool);
+}
+
+TEST_CASE("Deserialize batch with bad frames" * test_suite("batch")) {
+  using namespace test_batch;
+  constexpr auto OPTIONS = options::with_checksum;
+
+  std::vector<std::vector<uint8_t>> frames(200);
+  for (std::size_t i = 0; i < frames.size(); ++i) {
+    serialize<OPTIONS>(message{i, "ok", {1, 2, 3}}, frames[i]);
+  }
+  frames[7].clear();     // empty
+  frames[150][3] ^= 0xff; // corrupt
+
+  // frames can also be non-owning views
+  std::vector<byte_span> spans(frames.begin(), frames.end());
+
+  thread_pool pool(3);
+  std::vector<message> output(spans.size());
+  auto error_codes =
+      deserialize_batch<OPTIONS, message>(spans, output.begin(), pool);
+
+  for (std::size_t i = 0; i < spans.size(); ++i) {
+    if (i == 7) {
+      REQUIRE(error_codes[i] == std::errc::message_size);
+    } else if (i == 150) {
+      REQUIRE(error_codes[i] == std::errc::bad_message);
+    } else {
+      REQUIRE((bool)error_codes[i] == false);
+      REQUIRE(output[i].id == i);
+      REQUIRE(output[i].values == std::vector<int>{1, 2, 3});
+    }
+  }
+}
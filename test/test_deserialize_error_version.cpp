@@ -76,4 +76,33 @@ TEST_CASE("Deserialize vector<int> into struct { vector<float> }" *
     REQUIRE((bool)ec == true);
     REQUIRE(ec.value() == static_cast<int>(std::errc::invalid_argument));
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Deserialize bitset<12> into struct { bitset<16> }" *
+          test_suite("version")) {
+
+  std::vector<uint8_t> bytes;
+
+  {
+    struct my_struct {
+      std::bitset<12> value;
+    };
+    my_struct s{0xABC};
+    serialize<options::with_version>(s, bytes);
+
+    std::error_code ec;
+    auto recovered = deserialize<options::with_version, my_struct>(bytes, ec);
+    REQUIRE((bool)ec == false);
+    REQUIRE(recovered.value == s.value);
+  }
+
+  {
+    struct my_struct {
+      std::bitset<16> value;
+    };
+    std::error_code ec;
+    deserialize<options::with_version, my_struct>(bytes, ec);
+    REQUIRE((bool)ec == true);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::invalid_argument));
+  }
+}
@@ -73,4 +73,42 @@ TEST_CASE("Deserialize unordered_map<string, vector<int>>" *
     REQUIRE(
         (result.value.at("x") == std::map<int, double>{{3, 4.4}, {4, 5.5}}));
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Deserialize large map<string, vector<int>>" * test_suite("map")) {
+  struct my_struct {
+    std::map<std::string, std::vector<int>> value;
+  };
+
+  std::vector<uint8_t> bytes;
+
+  my_struct s;
+  for (int i = 0; i < 10000; ++i) {
+    s.value[std::to_string(i)] = std::vector<int>(3, i);
+  }
+  serialize(s, bytes);
+
+  {
+    std::error_code ec;
+    auto result = deserialize<my_struct>(bytes, ec);
+    REQUIRE((bool)ec == false);
+    REQUIRE(result.value == s.value);
+  }
+}
+
+TEST_CASE("Deserialize map<int, int> with keys out of order" *
+          test_suite("map")) {
+  struct my_struct {
+    std::map<int, int> value;
+  };
+
+  // hand-written input, not sorted by key
+  // {3: 30, 1: 10, 2: 20, 1: 99}
+  std::vector<uint8_t> bytes{0x04, 0x03, 0x1e, 0x01, 0x0a,
+                             0x02, 0x14, 0x01, 0x63};
+
+  std::error_code ec;
+  auto result = deserialize<my_struct>(bytes, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE((result.value == std::map<int, int>{{1, 10}, {2, 20}, {3, 30}}));
+}
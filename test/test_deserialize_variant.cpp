@@ -70,4 +70,52 @@ TEST_CASE("Deserialize map<string, variant>" * test_suite("variant")) {
     REQUIRE(std::get<3>(value) ==
             std::vector<std::string>{"motor_state", "battery_state"});
   }
-}
\ No newline at end of file
+}
+
+TEST_CASE("Deserialize variant with invalid index" * test_suite("variant")) {
+  struct my_struct {
+    std::variant<int, std::string> value;
+  };
+
+  // index 2 is out of range
+  std::vector<uint8_t> bytes{0x02, 0x05};
+
+  std::error_code ec;
+  deserialize<my_struct>(bytes, ec);
+  REQUIRE((bool)ec == true);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+}
+
+namespace test_variant {
+template <std::size_t... I>
+auto make_wide_variant(std::index_sequence<I...>)
+    -> std::variant<std::array<uint8_t, I + 1>...>;
+
+// more alternatives than the old 99-way if-chain supported
+using wide_variant = decltype(make_wide_variant(std::make_index_sequence<120>{}));
+} // namespace test_variant
+
+TEST_CASE("Deserialize variant with 120 alternatives" * test_suite("variant")) {
+  using namespace test_variant;
+
+  struct my_struct {
+    wide_variant value;
+  };
+
+  std::array<uint8_t, 110> last{};
+  last.back() = 42;
+
+  std::vector<uint8_t> bytes;
+  {
+    my_struct s{wide_variant{std::in_place_index<109>, last}};
+    serialize(s, bytes);
+  }
+
+  {
+    std::error_code ec;
+    auto result = deserialize<my_struct>(bytes, ec);
+    REQUIRE((bool)ec == false);
+    REQUIRE(result.value.index() == 109);
+    REQUIRE(std::get<109>(result.value) == last);
+  }
+}
@@ -0,0 +1,156 @@
+#include <alpaca/alpaca.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_limits {
+struct node {
+  int value;
+  std::unique_ptr<node> next;
+};
+
+std::unique_ptr<node> make_list(int length) {
+  std::unique_ptr<node> head;
+  for (int i = length; i > 0; --i) {
+    head = std::make_unique<node>(node{i, std::move(head)});
+  }
+  return head;
+}
+} // namespace test_limits
+
+TEST_CASE("Deserialize within limits" * test_suite("limits")) {
+  struct my_struct {
+    std::vector<uint64_t> values;
+    std::map<std::string, std::string> names;
+  };
+
+  my_struct s{{1, 2, 3}, {{"a", "b"}}};
+  std::vector<uint8_t> bytes;
+  serialize(s, bytes);
+
+  decode_limits limits;
+  limits.max_bytes_allocated = 1024;
+  limits.max_elements = 16;
+  limits.max_depth = 4;
+
+  std::error_code ec;
+  auto recovered = deserialize<my_struct>(bytes, limits, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(recovered.values == s.values);
+  REQUIRE(recovered.names == s.names);
+}
+
+TEST_CASE("Deserialize exceeding max bytes allocated" * test_suite("limits")) {
+  struct big {
+    std::array<uint64_t, 64> data;
+  };
+
+  struct my_struct {
+    std::vector<big> values;
+  };
+
+  // 1000 elements, each decoded from (at most) 1 byte of input
+  // would allocate 1000 * 512 bytes
+  std::vector<uint8_t> bytes;
+  std::size_t byte_index = 0;
+  detail::to_bytes_router<options::none, std::size_t>(1000, bytes, byte_index);
+  bytes.resize(bytes.size() + 1000);
+
+  decode_limits limits;
+  limits.max_bytes_allocated = 64 * 1024;
+
+  std::error_code ec;
+  auto recovered = deserialize<my_struct>(bytes, limits, ec);
+  REQUIRE((bool)ec == true);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::not_enough_memory));
+  REQUIRE(recovered.values.empty());
+}
+
+TEST_CASE("Deserialize exceeding max elements" * test_suite("limits")) {
+  struct my_struct {
+    std::string name;
+    std::set<int> ids;
+  };
+
+  my_struct s{"ok", {1, 2, 3, 4, 5, 6, 7, 8, 9, 10}};
+  std::vector<uint8_t> bytes;
+  serialize(s, bytes);
+
+  decode_limits limits;
+  limits.max_elements = 8;
+
+  std::error_code ec;
+  deserialize<my_struct>(bytes, limits, ec);
+  REQUIRE((bool)ec == true);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::value_too_large));
+
+  // same input, without limits
+  ec.clear();
+  auto recovered = deserialize<my_struct>(bytes, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(recovered.ids == s.ids);
+}
+
+TEST_CASE("Deserialize exceeding max depth" * test_suite("limits")) {
+  using namespace test_limits;
+
+  struct my_struct {
+    std::unique_ptr<node> head;
+  };
+
+  my_struct s{make_list(10)};
+  std::vector<uint8_t> bytes;
+  serialize(s, bytes);
+
+  {
+    decode_limits limits;
+    limits.max_depth = 5;
+
+    std::error_code ec;
+    deserialize<my_struct>(bytes, limits, ec);
+    REQUIRE((bool)ec == true);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::result_out_of_range));
+  }
+
+  {
+    decode_limits limits;
+    limits.max_depth = 10;
+
+    std::error_code ec;
+    auto recovered = deserialize<my_struct>(bytes, limits, ec);
+    REQUIRE((bool)ec == false);
+
+    int count = 0;
+    for (auto p = recovered.head.get(); p != nullptr; p = p->next.get()) {
+      REQUIRE(p->value == ++count);
+    }
+    REQUIRE(count == 10);
+  }
+}
+
+TEST_CASE("Deserialize nested containers with depth limit" *
+          test_suite("limits")) {
+  struct my_struct {
+    std::vector<std::vector<std::vector<int>>> values;
+  };
+
+  my_struct s{{{{1, 2}, {3}}, {{4}}}};
+
+  constexpr auto OPTIONS = options::with_checksum;
+  std::vector<uint8_t> bytes;
+  serialize<OPTIONS>(s, bytes);
+
+  decode_limits limits;
+  limits.max_depth = 2;
+
+  std::error_code ec;
+  deserialize<OPTIONS, my_struct>(bytes, limits, ec);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::result_out_of_range));
+
+  limits.max_depth = 3;
+  ec.clear();
+  auto recovered = deserialize<OPTIONS, my_struct>(bytes, limits, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(recovered.values == s.values);
+}
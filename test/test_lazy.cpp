@@ -0,0 +1,151 @@
+#include <alpaca/alpaca.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_lazy {
+struct inner {
+  std::string name;
+  std::vector<int> values;
+};
+
+// number of fields has to be specified: std::optional
+// members break aggregate arity deduction
+struct my_struct {
+  uint64_t id;
+  std::map<std::string, std::vector<int>> table;
+  std::optional<std::string> comment;
+  inner nested;
+  std::variant<int, std::string> last;
+};
+} // namespace test_lazy
+
+TEST_CASE("Lazy decode single field" * test_suite("lazy")) {
+  using namespace test_lazy;
+  my_struct s{12345,
+              {{"a", {1, 2, 3}}, {"b", {4, 5}}},
+              "hello",
+              {"inner", {-1, 0, 1}},
+              std::string{"last"}};
+
+  std::vector<uint8_t> bytes;
+  serialize<my_struct, 5>(s, bytes);
+
+  std::error_code ec;
+  lazy<my_struct, options::none, 5> view(bytes, ec);
+  REQUIRE((bool)ec == false);
+
+  // access out of order - earlier fields are skipped, not decoded
+  auto last = view.get<4>(ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(std::get<std::string>(last) == "last");
+
+  auto nested = view.get<3>(ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(nested.name == "inner");
+  REQUIRE(nested.values == std::vector<int>{-1, 0, 1});
+
+  auto id = view.get<0>(ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(id == 12345);
+
+  auto table = view.get<1>(ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(table == s.table);
+
+  auto comment = view.get<2>(ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(comment.value() == "hello");
+}
+
+TEST_CASE("Lazy decode with options" * test_suite("lazy")) {
+  using namespace test_lazy;
+  my_struct s{7, {}, std::nullopt, {"x", {}}, 5};
+
+  constexpr auto OPTIONS = options::fixed_length_encoding |
+                           options::with_version | options::with_checksum;
+
+  std::vector<uint8_t> bytes;
+  serialize<OPTIONS, my_struct, 5>(s, bytes);
+
+  {
+    std::error_code ec;
+    lazy<my_struct, OPTIONS, 5> view(bytes, ec);
+    REQUIRE((bool)ec == false);
+    REQUIRE(std::get<int>(view.get<4>(ec)) == 5);
+    REQUIRE(view.get<3>(ec).name == "x");
+    REQUIRE(view.get<0>(ec) == 7);
+    REQUIRE((bool)ec == false);
+  }
+
+  {
+    // corrupt the payload - checksum must reject the view
+    bytes[5] ^= 0xFF;
+    std::error_code ec;
+    lazy<my_struct, OPTIONS, 5> view(bytes, ec);
+    REQUIRE((bool)ec == true);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::bad_message));
+
+    std::error_code get_ec;
+    view.get<0>(get_ec);
+    REQUIRE(get_ec == ec);
+  }
+}
+
+TEST_CASE("Lazy decode from array" * test_suite("lazy")) {
+  struct my_struct {
+    int a;
+    std::string b;
+    float c;
+  };
+
+  my_struct s{-5, "bytes", 3.5f};
+
+  std::array<uint8_t, 64> bytes;
+  auto size = serialize(s, bytes);
+
+  std::error_code ec;
+  lazy<my_struct, options::none, 3, std::array<uint8_t, 64>> view(bytes, size,
+                                                                   ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(view.get<2>(ec) == 3.5f);
+  REQUIRE(view.get<1>(ec) == "bytes");
+  REQUIRE(view.get<0>(ec) == -5);
+  REQUIRE((bool)ec == false);
+}
+
+TEST_CASE("Lazy decode truncated input" * test_suite("lazy")) {
+  struct my_struct {
+    std::string a;
+    int b;
+  };
+
+  my_struct s{"a long enough string", 5};
+
+  std::vector<uint8_t> bytes;
+  serialize(s, bytes);
+  bytes.resize(5);
+
+  std::error_code ec;
+  lazy<my_struct> view(bytes, ec);
+  REQUIRE((bool)ec == false);
+
+  view.get<1>(ec);
+  REQUIRE((bool)ec == true);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::value_too_large));
+}
+
+TEST_CASE("Lazy does not view a temporary" * test_suite("lazy")) {
+  struct my_struct {
+    int a;
+  };
+  using view_type = lazy<my_struct>;
+
+  static_assert(std::is_constructible_v<view_type, std::vector<uint8_t> &,
+                                        std::error_code &>);
+  static_assert(!std::is_constructible_v<view_type, std::vector<uint8_t>,
+                                         std::error_code &>);
+  static_assert(!std::is_constructible_v<view_type, std::vector<uint8_t>,
+                                         std::size_t, std::error_code &>);
+}
@@ -0,0 +1,186 @@
+#include "test_codec.h"
+#include <alpaca/profile.h>
+#include <doctest.hpp>
+#include <sstream>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_profile {
+struct item {
+  uint32_t id;
+  std::string name;
+};
+
+struct player {
+  std::string name;
+  std::vector<item> inventory;
+  uint64_t score;
+};
+
+player make_player() {
+  return player{"steve", {{1, "sword"}, {2, "shield"}, {300, "bow"}}, 12345};
+}
+
+const profile_entry *find(const std::deque<profile_entry> &entries,
+                          const std::string &path) {
+  for (const auto &entry : entries) {
+    if (entry.path == path) {
+      return &entry;
+    }
+  }
+  return nullptr;
+}
+} // namespace test_profile
+
+TEST_CASE("Profile serialize per field" * test_suite("profile")) {
+  using namespace test_profile;
+
+  profile<player> p;
+  std::vector<uint8_t> bytes;
+  const auto size = p.serialize(make_player(), bytes);
+
+  const std::string root(detail::type_name<player>());
+  const auto &entries = p.entries();
+  REQUIRE(entries.size() == 6);
+  REQUIRE(entries[0].path == root);
+  REQUIRE(entries[1].path == root + ".0");
+  REQUIRE(entries[2].path == root + ".1");
+  REQUIRE(entries[3].path == root + ".1[].0");
+  REQUIRE(entries[4].path == root + ".1[].1");
+  REQUIRE(entries[5].path == root + ".2");
+
+  REQUIRE(entries[0].serialize.calls == 1);
+  REQUIRE(entries[0].serialize.bytes == size);
+  REQUIRE(entries[0].serialize.bytes == bytes.size());
+
+  // size prefix and characters
+  REQUIRE(entries[1].serialize.bytes == 6);
+
+  // every item
+  REQUIRE(entries[3].serialize.calls == 3);
+  REQUIRE(entries[3].serialize.bytes == 1 + 1 + 2);
+  REQUIRE(entries[4].serialize.calls == 3);
+  REQUIRE(entries[4].serialize.bytes == 6 + 7 + 4);
+
+  // vector size, then the items
+  REQUIRE(entries[2].serialize.bytes ==
+          1 + entries[3].serialize.bytes + entries[4].serialize.bytes);
+
+  // the fields make up the whole message
+  REQUIRE(entries[1].serialize.bytes + entries[2].serialize.bytes +
+              entries[5].serialize.bytes ==
+          size);
+
+  // nested fields are part of their parent
+  REQUIRE(entries[2].serialize.time >=
+          entries[3].serialize.time + entries[4].serialize.time);
+
+  // nothing decoded yet
+  for (const auto &entry : entries) {
+    REQUIRE(entry.deserialize.calls == 0);
+  }
+}
+
+TEST_CASE("Profile deserialize per field" * test_suite("profile")) {
+  using namespace test_profile;
+
+  profile<player> p;
+  std::vector<uint8_t> bytes;
+  p.serialize(make_player(), bytes);
+  p.serialize(make_player(), bytes);
+
+  std::error_code ec;
+  auto result = p.deserialize(bytes, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(result.inventory.size() == 3);
+  REQUIRE(result.inventory[2].name == "bow");
+
+  const std::string root(detail::type_name<player>());
+  const auto &entries = p.entries();
+  REQUIRE(entries.size() == 6);
+
+  // calls add up
+  REQUIRE(entries[0].serialize.calls == 2);
+  REQUIRE(entries[0].serialize.bytes == bytes.size());
+  REQUIRE(entries[0].deserialize.calls == 1);
+  REQUIRE(entries[0].deserialize.bytes == bytes.size());
+
+  // every field reads what it wrote
+  for (std::size_t i = 1; i < entries.size(); ++i) {
+    REQUIRE(entries[i].deserialize.calls * 2 == entries[i].serialize.calls);
+    REQUIRE(entries[i].deserialize.bytes * 2 == entries[i].serialize.bytes);
+  }
+
+  const auto id = find(entries, root + ".1[].0");
+  REQUIRE(id != nullptr);
+  REQUIRE(id->type == detail::type_name<uint32_t>());
+
+  p.clear();
+  REQUIRE(p.entries().empty());
+}
+
+TEST_CASE("Profile with version and checksum" * test_suite("profile")) {
+  using namespace test_profile;
+  constexpr auto OPTIONS = options::with_version | options::with_checksum;
+
+  profile<player, OPTIONS> p;
+  std::vector<uint8_t> bytes;
+  const auto size = p.serialize(make_player(), bytes);
+
+  std::error_code ec;
+  p.deserialize(bytes, ec);
+  REQUIRE((bool)ec == false);
+
+  // version and checksum are part of the message, not of any field
+  const auto &entries = p.entries();
+  REQUIRE(entries[0].serialize.bytes == size);
+  REQUIRE(entries[1].serialize.bytes + entries[2].serialize.bytes +
+              entries[5].serialize.bytes ==
+          size - 8);
+  REQUIRE(entries[1].deserialize.bytes + entries[2].deserialize.bytes +
+              entries[5].deserialize.bytes ==
+          size - 8);
+}
+
+TEST_CASE("Profile report" * test_suite("profile")) {
+  using namespace test_profile;
+
+  profile<player> p;
+  std::vector<uint8_t> bytes;
+  p.serialize(make_player(), bytes);
+
+  std::ostringstream os;
+  p.report(os);
+  const auto report = os.str();
+
+  const std::string root(detail::type_name<player>());
+  REQUIRE(report.find("serialize\n") == 0);
+  REQUIRE(report.find("deserialize") == std::string::npos);
+  REQUIRE(report.find(root + ".1[].1 ") != std::string::npos);
+  REQUIRE(report.find("100.0") != std::string::npos);
+}
+
+TEST_CASE("Profile a type that is also serialized without profiling" *
+          test_suite("profile")) {
+  // test_codec_instantiation.cpp serializes the same type, uninstrumented
+  test_codec::player p{"steve", 42, {{"sword", 1}}, {{"hp", {20.0f}}}, true};
+
+  std::vector<uint8_t> expected;
+  codec<test_codec::player>::serialize(p, expected);
+
+  profile<test_codec::player> profile;
+  std::vector<uint8_t> bytes;
+  profile.serialize(p, bytes);
+  REQUIRE(bytes == expected);
+  REQUIRE(profile.entries().size() > 1);
+
+  // a plain call in this translation unit is not measured
+  const auto entries = profile.entries().size();
+  const auto calls = profile.entries().front().serialize.calls;
+  bytes.clear();
+  serialize(p, bytes);
+  REQUIRE(bytes == expected);
+  REQUIRE(profile.entries().size() == entries);
+  REQUIRE(profile.entries().front().serialize.calls == calls);
+}
@@ -0,0 +1,227 @@
+#include <alpaca/record_stream.h>
+#include <doctest.hpp>
+#include <sstream>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_record_stream {
+struct event {
+  uint64_t id;
+  std::string name;
+  std::vector<int> values;
+};
+
+event make_event(std::size_t i) {
+  return event{i, "event " + std::to_string(i),
+               std::vector<int>(i % 7, static_cast<int>(i))};
+}
+} // namespace test_record_stream
+
+TEST_CASE("Record stream round trip" * test_suite("record_stream")) {
+  using namespace test_record_stream;
+  constexpr std::size_t count = 5000;
+
+  std::stringstream stream;
+  std::size_t total = 0;
+  {
+    // small buffer, so records are written in many blocks
+    record_writer<event> writer(stream, 256);
+    std::error_code ec;
+    for (std::size_t i = 0; i < count; ++i) {
+      total += writer.write(make_event(i), ec);
+    }
+    writer.flush(ec);
+    REQUIRE((bool)ec == false);
+  }
+  REQUIRE(stream.str().size() == total);
+
+  record_reader<event> reader(stream, 1024, 100);
+  std::error_code ec;
+  event e;
+  std::size_t i = 0;
+  while (reader.next(e, ec)) {
+    REQUIRE(e.id == i);
+    REQUIRE(e.name == "event " + std::to_string(i));
+    REQUIRE(e.values.size() == i % 7);
+    ++i;
+  }
+  REQUIRE((bool)ec == false);
+  REQUIRE(i == count);
+}
+
+TEST_CASE("Record stream range-based for" * test_suite("record_stream")) {
+  using namespace test_record_stream;
+
+  std::stringstream stream;
+  {
+    record_writer<event> writer(stream);
+    std::error_code ec;
+    for (std::size_t i = 0; i < 100; ++i) {
+      writer.write(make_event(i), ec);
+    }
+  } // flushed on destruction
+
+  record_reader<event> reader(stream);
+  std::size_t i = 0;
+  for (const auto &e : reader) {
+    REQUIRE(e.id == i);
+    REQUIRE(e.values.size() == i % 7);
+    ++i;
+  }
+  REQUIRE(i == 100);
+  REQUIRE((bool)reader.error() == false);
+}
+
+TEST_CASE("Record stream empty" * test_suite("record_stream")) {
+  using namespace test_record_stream;
+
+  std::stringstream stream;
+  record_reader<event> reader(stream);
+  std::error_code ec;
+  event e;
+  REQUIRE(reader.next(e, ec) == false);
+  REQUIRE((bool)ec == false);
+}
+
+TEST_CASE("Record stream large records" * test_suite("record_stream")) {
+  using namespace test_record_stream;
+
+  std::stringstream stream;
+  {
+    // records larger than the writer and reader buffers
+    record_writer<event> writer(stream, 64);
+    std::error_code ec;
+    writer.write(event{1, "small", {1}}, ec);
+    writer.write(event{2, std::string(1000, 'x'), std::vector<int>(500, 7)},
+                 ec);
+    writer.write(event{3, "small", {3}}, ec);
+    writer.flush(ec);
+    REQUIRE((bool)ec == false);
+  }
+
+  record_reader<event> reader(stream, 1 << 20, 16);
+  std::error_code ec;
+  event e;
+  REQUIRE(reader.next(e, ec));
+  REQUIRE(e.id == 1);
+  REQUIRE(reader.next(e, ec));
+  REQUIRE(e.id == 2);
+  REQUIRE(e.name == std::string(1000, 'x'));
+  REQUIRE(e.values == std::vector<int>(500, 7));
+  REQUIRE(reader.next(e, ec));
+  REQUIRE(e.id == 3);
+  REQUIRE(e.values == std::vector<int>{3});
+  REQUIRE(reader.next(e, ec) == false);
+  REQUIRE((bool)ec == false);
+}
+
+TEST_CASE("Record stream record too large" * test_suite("record_stream")) {
+  using namespace test_record_stream;
+
+  std::stringstream stream;
+  {
+    record_writer<event> writer(stream);
+    std::error_code ec;
+    writer.write(event{1, std::string(1000, 'x'), {}}, ec);
+  }
+
+  record_reader<event> reader(stream, 100);
+  std::error_code ec;
+  event e;
+  REQUIRE(reader.next(e, ec) == false);
+  REQUIRE(ec == std::errc::value_too_large);
+}
+
+TEST_CASE("Record stream skips a record that is too large" *
+          test_suite("record_stream")) {
+  using namespace test_record_stream;
+
+  std::stringstream stream;
+  {
+    record_writer<event> writer(stream);
+    std::error_code ec;
+    writer.write(make_event(1), ec);
+    writer.write(event{2, std::string(1000, 'x'), {}}, ec);
+    writer.write(make_event(3), ec);
+  }
+
+  // the large record fits in the buffer, or is read past the buffer
+  for (std::size_t buffer_size : {std::size_t{16}, std::size_t{64 * 1024}}) {
+    std::stringstream input(stream.str());
+    record_reader<event> reader(input, 100, buffer_size);
+
+    std::error_code ec;
+    event e;
+    REQUIRE(reader.next(e, ec));
+    REQUIRE(e.id == 1);
+    REQUIRE(reader.next(e, ec) == false);
+    REQUIRE(ec == std::errc::value_too_large);
+
+    // the reader is still aligned on the record after it
+    ec.clear();
+    REQUIRE(reader.next(e, ec));
+    REQUIRE(e.id == 3);
+    REQUIRE(e.values.size() == 3);
+    REQUIRE(reader.next(e, ec) == false);
+    REQUIRE((bool)ec == false);
+  }
+}
+
+TEST_CASE("Record stream torn tail" * test_suite("record_stream")) {
+  using namespace test_record_stream;
+
+  std::stringstream stream;
+  {
+    record_writer<event> writer(stream);
+    std::error_code ec;
+    writer.write(make_event(1), ec);
+    writer.write(make_event(2), ec);
+  }
+
+  // drop the last bytes, as if the writer crashed mid-record
+  auto bytes = stream.str();
+  std::stringstream torn(bytes.substr(0, bytes.size() - 3));
+
+  record_reader<event> reader(torn);
+  std::error_code ec;
+  event e;
+  REQUIRE(reader.next(e, ec));
+  REQUIRE(e.id == 1);
+  REQUIRE(reader.next(e, ec) == false);
+  REQUIRE(ec == std::errc::message_size);
+}
+
+TEST_CASE("Record stream with checksum" * test_suite("record_stream")) {
+  using namespace test_record_stream;
+  constexpr auto OPTIONS = options::with_checksum;
+
+  std::stringstream stream;
+  std::size_t first_size = 0;
+  {
+    record_writer<event, OPTIONS> writer(stream);
+    std::error_code ec;
+    first_size = writer.write(make_event(1), ec);
+    writer.write(make_event(2), ec);
+    writer.write(make_event(3), ec);
+  }
+
+  // corrupt the second record
+  auto bytes = stream.str();
+  bytes[first_size + 3] ^= 0xff;
+  std::stringstream corrupt(bytes);
+
+  record_reader<event, OPTIONS> reader(corrupt);
+  std::error_code ec;
+  event e;
+  REQUIRE(reader.next(e, ec));
+  REQUIRE(e.id == 1);
+  REQUIRE(reader.next(e, ec) == false);
+  REQUIRE(ec == std::errc::bad_message);
+
+  // the corrupt record is skipped
+  ec.clear();
+  REQUIRE(reader.next(e, ec));
+  REQUIRE(e.id == 3);
+  REQUIRE(e.values.size() == 3);
+}
@@ -0,0 +1,204 @@
+#include <alpaca/batch.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_chunk_index {
+struct record {
+  uint64_t id;
+  std::string text;
+};
+
+struct snapshot {
+  std::string name;
+  std::vector<record> records;
+  std::vector<std::vector<std::string>> groups;
+  std::vector<float> values;
+};
+
+snapshot make_snapshot(std::size_t count) {
+  snapshot s{"snapshot", {}, {}, {}};
+  for (std::size_t i = 0; i < count; ++i) {
+    s.records.push_back(record{i, std::string(i % 17, 'a' + i % 26)});
+    s.values.push_back(static_cast<float>(i) / 2);
+  }
+  s.groups.push_back(std::vector<std::string>(5000, "nested"));
+  s.groups.push_back({"small"});
+  return s;
+}
+
+void require_equal(const snapshot &lhs, const snapshot &rhs) {
+  REQUIRE(lhs.name == rhs.name);
+  REQUIRE(lhs.records.size() == rhs.records.size());
+  for (std::size_t i = 0; i < lhs.records.size(); ++i) {
+    REQUIRE(lhs.records[i].id == rhs.records[i].id);
+    REQUIRE(lhs.records[i].text == rhs.records[i].text);
+  }
+  REQUIRE(lhs.groups == rhs.groups);
+  REQUIRE(lhs.values == rhs.values);
+}
+} // namespace test_chunk_index
+
+TEST_CASE("Serialize and deserialize with chunk index" *
+          test_suite("chunk_index")) {
+  using namespace test_chunk_index;
+  constexpr auto OPTIONS = options::with_chunk_index;
+
+  auto s = make_snapshot(10000);
+  std::vector<uint8_t> bytes;
+  serialize<OPTIONS>(s, bytes);
+
+  {
+    // on the calling thread
+    std::error_code ec;
+    auto recovered = deserialize<OPTIONS, snapshot>(bytes, ec);
+    REQUIRE((bool)ec == false);
+    require_equal(recovered, s);
+  }
+
+  {
+    thread_pool pool(4);
+    std::error_code ec;
+    auto recovered = deserialize_parallel<OPTIONS, snapshot>(bytes, pool, ec);
+    REQUIRE((bool)ec == false);
+    require_equal(recovered, s);
+  }
+
+  {
+    // with limits, chunks are decoded on the calling thread
+    decode_limits limits;
+    limits.max_elements = 10000;
+    std::error_code ec;
+    auto recovered = deserialize<OPTIONS, snapshot>(bytes, limits, ec);
+    REQUIRE((bool)ec == false);
+    require_equal(recovered, s);
+  }
+
+  {
+    std::error_code ec;
+    REQUIRE(validate<OPTIONS, snapshot>(bytes, ec) == bytes.size());
+    REQUIRE((bool)ec == false);
+  }
+}
+
+TEST_CASE("Chunk index layout" * test_suite("chunk_index")) {
+  constexpr auto OPTIONS = options::with_chunk_index;
+
+  struct my_struct {
+    std::vector<std::string> values;
+  };
+
+  {
+    // a single chunk is written as usual
+    my_struct s{std::vector<std::string>(4096, "x")};
+    std::vector<uint8_t> chunked, plain;
+    serialize<OPTIONS>(s, chunked);
+    serialize(s, plain);
+    REQUIRE(chunked == plain);
+  }
+
+  {
+    // 4097 elements -> 2 chunks
+    my_struct s{std::vector<std::string>(4097, "x")};
+    std::vector<uint8_t> bytes;
+    serialize<OPTIONS>(s, bytes);
+
+    // varint 4097, then two uint64_t chunk sizes
+    REQUIRE(bytes[0] == 0x81);
+    REQUIRE(bytes[1] == 0x20);
+    const std::vector<uint8_t> first{0x00, 0x20, 0, 0, 0, 0, 0, 0}; // 8192
+    const std::vector<uint8_t> second{0x02, 0, 0, 0, 0, 0, 0, 0};   // 2
+    REQUIRE(std::vector<uint8_t>(bytes.begin() + 2, bytes.begin() + 10) ==
+            first);
+    REQUIRE(std::vector<uint8_t>(bytes.begin() + 10, bytes.begin() + 18) ==
+            second);
+    REQUIRE(bytes.size() == 18 + 4097 * 2);
+  }
+}
+
+TEST_CASE("Serialize parallel with chunk index" * test_suite("chunk_index")) {
+  using namespace test_chunk_index;
+  constexpr auto OPTIONS = options::with_chunk_index | options::with_checksum;
+
+  auto s = make_snapshot(30000);
+
+  std::vector<uint8_t> expected;
+  serialize<OPTIONS>(s, expected);
+
+  thread_pool pool(3);
+  std::vector<uint8_t> bytes;
+  serialize_parallel<OPTIONS>(s, bytes, pool);
+  REQUIRE(bytes == expected);
+
+  std::error_code ec;
+  auto recovered = deserialize_parallel<OPTIONS, snapshot>(bytes, pool, ec);
+  REQUIRE((bool)ec == false);
+  require_equal(recovered, s);
+}
+
+TEST_CASE("Deserialize chunk index with bad chunk sizes" *
+          test_suite("chunk_index")) {
+  constexpr auto OPTIONS = options::with_chunk_index;
+
+  struct my_struct {
+    std::vector<std::string> values;
+  };
+
+  my_struct s{std::vector<std::string>(5000, "abc")};
+  std::vector<uint8_t> bytes;
+  serialize<OPTIONS>(s, bytes);
+
+  thread_pool pool(2);
+
+  SUBCASE("chunk size does not match elements") {
+    bytes[2] += 1; // first chunk one byte longer
+    bytes[10] -= 1;
+
+    std::error_code ec;
+    deserialize_parallel<OPTIONS, my_struct>(bytes, pool, ec);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+
+    ec.clear();
+    REQUIRE(validate<OPTIONS, my_struct>(bytes, ec) == 0);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+  }
+
+  SUBCASE("chunk size past end of input") {
+    bytes[9] = 0x01;
+
+    std::error_code ec;
+    deserialize_parallel<OPTIONS, my_struct>(bytes, pool, ec);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::value_too_large));
+  }
+}
+
+TEST_CASE("Deserialize chunk index with a chunk size that is too small" *
+          test_suite("chunk_index")) {
+  constexpr auto OPTIONS = options::with_chunk_index;
+
+  struct my_struct {
+    std::vector<std::string> values;
+  };
+
+  my_struct s{std::vector<std::string>(4097, "abc")};
+  std::vector<uint8_t> bytes;
+  serialize<OPTIONS>(s, bytes);
+
+  // the first chunk claims no bytes, the second one the bytes of one string
+  std::fill(bytes.begin() + 2, bytes.begin() + 18, 0);
+  bytes[10] = 4;
+
+  std::error_code ec;
+  deserialize<OPTIONS, my_struct>(bytes, ec);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+
+  thread_pool pool(2);
+  ec.clear();
+  deserialize_parallel<OPTIONS, my_struct>(bytes, pool, ec);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+
+  ec.clear();
+  REQUIRE(validate<OPTIONS, my_struct>(bytes, ec) == 0);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+}
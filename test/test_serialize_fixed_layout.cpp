@@ -0,0 +1,157 @@
+#include <alpaca/alpaca.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_fixed_layout {
+struct vec3 {
+  float x;
+  float y;
+  float z;
+};
+
+struct padded {
+  uint8_t a;
+  uint32_t b;
+};
+
+struct nested {
+  vec3 position;
+  std::array<padded, 2> items;
+  bool flag;
+};
+
+struct variable {
+  vec3 position;
+  std::string name;
+};
+
+enum class color : uint16_t { red, green };
+
+struct with_enum {
+  color c;
+  int16_t d;
+};
+} // namespace test_fixed_layout
+
+TEST_CASE("Fixed serialized size" * test_suite("fixed_layout")) {
+  using namespace test_fixed_layout;
+
+  static_assert(fixed_serialized_size_v<vec3> == 12);
+  static_assert(fixed_serialized_size_v<with_enum> == 4);
+
+  // varints by default, fixed with options
+  static_assert(fixed_serialized_size_v<padded> == 0);
+  static_assert(
+      fixed_serialized_size_v<padded, options::fixed_length_encoding> == 5);
+  static_assert(fixed_serialized_size_v<padded, options::big_endian> == 5);
+
+  // nested structs and arrays collapse
+  static_assert(
+      fixed_serialized_size_v<nested, options::fixed_length_encoding> ==
+      12 + 2 * 5 + 1);
+  static_assert(fixed_serialized_size_v<std::array<vec3, 4>> == 48);
+
+  // containers are never fixed
+  static_assert(fixed_serialized_size_v<variable> == 0);
+  static_assert(fixed_serialized_size_v<std::vector<float>> == 0);
+}
+
+TEST_CASE("Serialize fixed layout struct" * test_suite("fixed_layout")) {
+  using namespace test_fixed_layout;
+
+  vec3 s{1.0f, -2.0f, 0.5f};
+  std::vector<uint8_t> bytes;
+  REQUIRE(serialize(s, bytes) == 12);
+  REQUIRE(bytes.size() == 12);
+
+  // little endian floats
+  REQUIRE(bytes[0] == 0x00);
+  REQUIRE(bytes[3] == 0x3f);
+  REQUIRE(bytes[7] == 0xc0);
+  REQUIRE(bytes[11] == 0x3f);
+
+  std::error_code ec;
+  auto recovered = deserialize<vec3>(bytes, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(recovered.x == s.x);
+  REQUIRE(recovered.y == s.y);
+  REQUIRE(recovered.z == s.z);
+}
+
+TEST_CASE("Serialize fixed layout with padding" * test_suite("fixed_layout")) {
+  using namespace test_fixed_layout;
+
+  nested s{{1.0f, 2.0f, 3.0f}, {{{0x11, 0xAABBCCDD}, {0x22, 5}}}, true};
+
+  {
+    constexpr auto OPTIONS = options::fixed_length_encoding;
+    std::array<uint8_t, 64> bytes;
+    REQUIRE(serialize<OPTIONS>(s, bytes) == 23);
+
+    // no padding in the output
+    REQUIRE(bytes[12] == 0x11);
+    REQUIRE(bytes[13] == 0xDD);
+    REQUIRE(bytes[14] == 0xCC);
+    REQUIRE(bytes[15] == 0xBB);
+    REQUIRE(bytes[16] == 0xAA);
+    REQUIRE(bytes[17] == 0x22);
+    REQUIRE(bytes[18] == 0x05);
+    REQUIRE(bytes[22] == 0x01);
+
+    std::error_code ec;
+    auto recovered = deserialize<OPTIONS, nested>(bytes, 23, ec);
+    REQUIRE((bool)ec == false);
+    REQUIRE(recovered.position.z == 3.0f);
+    REQUIRE(recovered.items[0].b == 0xAABBCCDD);
+    REQUIRE(recovered.items[1].a == 0x22);
+    REQUIRE(recovered.flag == true);
+  }
+
+  {
+    // byte-swapped output
+    constexpr auto OPTIONS = options::big_endian;
+    std::vector<uint8_t> bytes;
+    REQUIRE(serialize<OPTIONS>(s, bytes) == 23);
+    REQUIRE(bytes[0] == 0x3f);
+    REQUIRE(bytes[3] == 0x00);
+    REQUIRE(bytes[12] == 0x11);
+    REQUIRE(bytes[13] == 0xAA);
+    REQUIRE(bytes[16] == 0xDD);
+
+    std::error_code ec;
+    auto recovered = deserialize<OPTIONS, nested>(bytes, ec);
+    REQUIRE((bool)ec == false);
+    REQUIRE(recovered.items[0].b == 0xAABBCCDD);
+  }
+}
+
+TEST_CASE("Serialize vector of fixed layout structs" *
+          test_suite("fixed_layout")) {
+  using namespace test_fixed_layout;
+
+  struct my_struct {
+    std::vector<vec3> points;
+    std::vector<uint8_t> raw;
+  };
+
+  my_struct s{{{1, 2, 3}, {4, 5, 6}}, {1, 2, 3, 4, 5}};
+
+  std::vector<uint8_t> bytes;
+  REQUIRE(serialize(s, bytes) == 1 + 24 + 1 + 5);
+  REQUIRE(bytes[0] == 2);
+  REQUIRE(bytes[25] == 5);
+  REQUIRE(bytes[30] == 5);
+
+  uint8_t carray[64];
+  REQUIRE(serialize(s, carray) == 31);
+  REQUIRE(std::equal(bytes.begin(), bytes.end(), carray));
+
+  std::error_code ec;
+  auto recovered = deserialize<my_struct>(bytes, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(recovered.points.size() == 2);
+  REQUIRE(recovered.points[1].z == 6);
+  REQUIRE(recovered.raw == s.raw);
+}
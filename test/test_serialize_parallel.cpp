@@ -0,0 +1,76 @@
+#include <alpaca/batch.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_parallel {
+struct entry {
+  uint32_t code;
+  std::string text;
+  std::vector<uint16_t> values;
+};
+
+struct snapshot {
+  std::string name;
+  std::vector<entry> entries;
+  std::vector<uint64_t> ids;
+  std::map<int, std::string> index;
+};
+
+snapshot make_snapshot(std::size_t count) {
+  snapshot s{"snapshot", {}, {}, {{1, "a"}, {2, "b"}}};
+  for (std::size_t i = 0; i < count; ++i) {
+    s.entries.push_back(entry{static_cast<uint32_t>(i * 7919),
+                              std::string(i % 13, 'x'),
+                              std::vector<uint16_t>(i % 5, 3)});
+    s.ids.push_back(i * i);
+  }
+  return s;
+}
+} // namespace test_parallel
+
+TEST_CASE("Serialize parallel matches serialize" *
+          test_suite("serialize_parallel")) {
+  using namespace test_parallel;
+
+  thread_pool pool(4);
+
+  // below, at and above the size that is split into chunks
+  for (std::size_t count : {0, 100, 8191, 8192, 50000}) {
+    auto s = make_snapshot(count);
+
+    std::vector<uint8_t> expected;
+    auto expected_size = serialize(s, expected);
+
+    std::vector<uint8_t> bytes;
+    auto bytes_written = serialize_parallel(s, bytes, pool);
+
+    REQUIRE(bytes_written == expected_size);
+    REQUIRE(bytes == expected);
+  }
+}
+
+TEST_CASE("Serialize parallel with options" *
+          test_suite("serialize_parallel")) {
+  using namespace test_parallel;
+  constexpr auto OPTIONS = options::with_version | options::with_checksum |
+                           options::fixed_length_encoding;
+
+  auto s = make_snapshot(20000);
+
+  std::vector<uint8_t> expected;
+  serialize<OPTIONS>(s, expected);
+
+  thread_pool pool(3);
+  std::vector<uint8_t> bytes;
+  serialize_parallel<OPTIONS>(s, bytes, pool);
+  REQUIRE(bytes == expected);
+
+  std::error_code ec;
+  auto recovered = deserialize<OPTIONS, snapshot>(bytes, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(recovered.entries.size() == 20000);
+  REQUIRE(recovered.entries[12345].text == s.entries[12345].text);
+  REQUIRE(recovered.ids == s.ids);
+}
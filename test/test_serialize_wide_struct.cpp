@@ -0,0 +1,97 @@
+#include <alpaca/alpaca.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+namespace test_wide_struct {
+// 256 fields, the most that alpaca supports
+struct wide {
+  int f0, f1, f2, f3, f4, f5, f6, f7;
+  int f8, f9, f10, f11, f12, f13, f14, f15;
+  int f16, f17, f18, f19, f20, f21, f22, f23;
+  int f24, f25, f26, f27, f28, f29, f30, f31;
+  int f32, f33, f34, f35, f36, f37, f38, f39;
+  int f40, f41, f42, f43, f44, f45, f46, f47;
+  int f48, f49, f50, f51, f52, f53, f54, f55;
+  int f56, f57, f58, f59, f60, f61, f62, f63;
+  int f64, f65, f66, f67, f68, f69, f70, f71;
+  int f72, f73, f74, f75, f76, f77, f78, f79;
+  int f80, f81, f82, f83, f84, f85, f86, f87;
+  int f88, f89, f90, f91, f92, f93, f94, f95;
+  int f96, f97, f98, f99, f100, f101, f102, f103;
+  int f104, f105, f106, f107, f108, f109, f110, f111;
+  int f112, f113, f114, f115, f116, f117, f118, f119;
+  int f120, f121, f122, f123, f124, f125, f126, f127;
+  int f128, f129, f130, f131, f132, f133, f134, f135;
+  int f136, f137, f138, f139, f140, f141, f142, f143;
+  int f144, f145, f146, f147, f148, f149, f150, f151;
+  int f152, f153, f154, f155, f156, f157, f158, f159;
+  int f160, f161, f162, f163, f164, f165, f166, f167;
+  int f168, f169, f170, f171, f172, f173, f174, f175;
+  int f176, f177, f178, f179, f180, f181, f182, f183;
+  int f184, f185, f186, f187, f188, f189, f190, f191;
+  int f192, f193, f194, f195, f196, f197, f198, f199;
+  int f200, f201, f202, f203, f204, f205, f206, f207;
+  int f208, f209, f210, f211, f212, f213, f214, f215;
+  int f216, f217, f218, f219, f220, f221, f222, f223;
+  int f224, f225, f226, f227, f228, f229, f230, f231;
+  int f232, f233, f234, f235, f236, f237, f238, f239;
+  int f240, f241, f242, f243, f244, f245, f246, f247;
+  int f248, f249, f250, f251, f252, f253, f254, f255;
+};
+
+struct nested {
+  std::string name;
+  wide values;
+  std::vector<wide> more;
+};
+} // namespace test_wide_struct
+
+TEST_CASE("Serialize and deserialize struct with 256 fields" *
+          test_suite("wide_struct")) {
+  using namespace test_wide_struct;
+  static_assert(detail::aggregate_arity<wide>::size() == 256);
+
+  wide s{};
+  s.f0 = 1;
+  s.f100 = -100;
+  s.f200 = 200;
+  s.f255 = 255;
+
+  std::vector<uint8_t> bytes;
+  auto bytes_written = serialize(s, bytes);
+  REQUIRE(bytes_written == bytes.size());
+
+  std::error_code ec;
+  auto result = deserialize<wide>(bytes, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(result.f0 == 1);
+  REQUIRE(result.f1 == 0);
+  REQUIRE(result.f100 == -100);
+  REQUIRE(result.f200 == 200);
+  REQUIRE(result.f254 == 0);
+  REQUIRE(result.f255 == 255);
+}
+
+TEST_CASE("Serialize and deserialize nested struct with 256 fields" *
+          test_suite("wide_struct")) {
+  using namespace test_wide_struct;
+
+  nested s{"wide", wide{}, std::vector<wide>(3)};
+  s.values.f128 = 128;
+  s.more[2].f255 = -1;
+
+  constexpr auto OPTIONS = options::with_version | options::with_checksum;
+  std::vector<uint8_t> bytes;
+  serialize<OPTIONS>(s, bytes);
+
+  std::error_code ec;
+  auto result = deserialize<OPTIONS, nested>(bytes, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(result.name == "wide");
+  REQUIRE(result.values.f128 == 128);
+  REQUIRE(result.more.size() == 3);
+  REQUIRE(result.more[2].f255 == -1);
+  REQUIRE(result.more[0].f255 == 0);
+}
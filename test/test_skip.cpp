@@ -0,0 +1,151 @@
+#include <alpaca/alpaca.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+TEST_CASE("Skip struct" * test_suite("skip")) {
+  struct inner {
+    std::string name;
+    std::set<int64_t> ids;
+  };
+
+  struct my_struct {
+    int32_t a;
+    std::map<std::string, std::vector<uint32_t>> b;
+    std::variant<int, std::string, inner> c;
+    std::unique_ptr<inner> d;
+    std::tuple<char, float, std::wstring> e;
+    std::array<std::pair<uint16_t, double>, 2> f;
+    std::list<std::deque<bool>> g;
+    std::chrono::milliseconds h;
+    std::bitset<12> i;
+  };
+
+  my_struct s{-123456,
+              {{"a", {1, 2, 300000}}, {"b", {}}},
+              inner{"inner", {-1, 1, 1000000000}},
+              std::make_unique<inner>(inner{"ptr", {5}}),
+              {'x', 2.5f, L"wide"},
+              {{{1, 1.5}, {2, 2.5}}},
+              {{true, false}, {}},
+              std::chrono::milliseconds{42},
+              std::bitset<12>{0xABC}};
+
+  std::vector<uint8_t> bytes;
+  auto bytes_written = serialize(s, bytes);
+
+  // skipping the whole struct consumes every byte
+  std::error_code ec;
+  std::size_t byte_index = 0;
+  std::size_t end_index = bytes.size();
+  REQUIRE(skip<my_struct>(bytes, byte_index, end_index, ec));
+  REQUIRE((bool)ec == false);
+  REQUIRE(byte_index == bytes_written);
+}
+
+TEST_CASE("Skip struct with options" * test_suite("skip")) {
+  struct my_struct {
+    uint64_t a;
+    std::vector<int32_t> b;
+    std::string c;
+  };
+
+  my_struct s{1ULL << 40, {-1, 0, 1 << 20}, "hello"};
+
+  constexpr auto OPTIONS = options::big_endian | options::fixed_length_encoding;
+
+  std::vector<uint8_t> bytes;
+  auto bytes_written = serialize<OPTIONS>(s, bytes);
+
+  std::error_code ec;
+  std::size_t byte_index = 0;
+  std::size_t end_index = bytes.size();
+  REQUIRE(skip<OPTIONS, my_struct>(bytes, byte_index, end_index, ec));
+  REQUIRE((bool)ec == false);
+  REQUIRE(byte_index == bytes_written);
+}
+
+TEST_CASE("Skip individual values" * test_suite("skip")) {
+  struct my_struct {
+    std::string a;
+    std::vector<int> b;
+  };
+
+  my_struct s{"first", {1, 2, 3}};
+
+  std::array<uint8_t, 32> bytes;
+  auto bytes_written = serialize(s, bytes);
+
+  std::error_code ec;
+  std::size_t byte_index = 0;
+  std::size_t end_index = bytes_written;
+
+  // skip the string, then decode the vector in place
+  REQUIRE(skip<std::string>(bytes, byte_index, end_index, ec));
+  REQUIRE(byte_index == 6);
+
+  std::vector<int> b;
+  detail::from_bytes<options::none>(b, bytes, byte_index, end_index, ec);
+  REQUIRE((bool)ec == false);
+  REQUIRE(b == std::vector<int>{1, 2, 3});
+  REQUIRE(byte_index == bytes_written);
+}
+
+TEST_CASE("Skip truncated input" * test_suite("skip")) {
+  struct my_struct {
+    std::string a;
+  };
+
+  my_struct s{"truncated"};
+
+  std::vector<uint8_t> bytes;
+  serialize(s, bytes);
+  bytes.pop_back();
+
+  std::error_code ec;
+  std::size_t byte_index = 0;
+  std::size_t end_index = bytes.size();
+  REQUIRE(skip<my_struct>(bytes, byte_index, end_index, ec) == false);
+  REQUIRE((bool)ec == true);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::value_too_large));
+}
+
+TEST_CASE("Skip unterminated varint" * test_suite("skip")) {
+  // continuation bit set on every byte
+  std::vector<uint8_t> bytes(16, 0xFF);
+
+  std::error_code ec;
+  std::size_t byte_index = 0;
+  std::size_t end_index = bytes.size();
+  REQUIRE(skip<uint64_t>(bytes, byte_index, end_index, ec) == false);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+
+  // varint runs past the end of input
+  ec.clear();
+  byte_index = 0;
+  end_index = 3;
+  REQUIRE(skip<uint64_t>(bytes, byte_index, end_index, ec) == false);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::message_size));
+}
+
+TEST_CASE("Skip invalid optional flag" * test_suite("skip")) {
+  std::vector<uint8_t> bytes{0x02, 0x05};
+
+  std::error_code ec;
+  std::size_t byte_index = 0;
+  std::size_t end_index = bytes.size();
+  REQUIRE(skip<std::optional<int>>(bytes, byte_index, end_index, ec) == false);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+}
+
+TEST_CASE("Skip invalid variant index" * test_suite("skip")) {
+  std::vector<uint8_t> bytes{0x02, 0x05};
+
+  std::error_code ec;
+  std::size_t byte_index = 0;
+  std::size_t end_index = bytes.size();
+  REQUIRE(skip<std::variant<int, bool>>(bytes, byte_index, end_index, ec) ==
+          false);
+  REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+}
@@ -0,0 +1,155 @@
+#include <alpaca/alpaca.h>
+#include <allocation_counter.h>
+#include <doctest.hpp>
+using namespace alpaca;
+
+using doctest::test_suite;
+
+// heap allocations made by the test binary, see
+// benchmark/allocation_counter.cpp
+static std::size_t num_allocations() {
+  return alpaca::benchmark::allocation_totals().allocations;
+}
+
+namespace test_validate {
+struct my_struct {
+  uint32_t id;
+  std::map<std::string, std::vector<int>> table;
+  std::variant<bool, std::string> tag;
+  std::unique_ptr<std::vector<double>> values;
+};
+
+my_struct make_struct() {
+  return my_struct{42,
+                   {{"a", {1, 2, 3}}, {"b", std::vector<int>(100, -7)}},
+                   std::string{"tag"},
+                   std::make_unique<std::vector<double>>(50, 1.5)};
+}
+} // namespace test_validate
+
+TEST_CASE("Validate well-formed input" * test_suite("validate")) {
+  using namespace test_validate;
+  auto s = make_struct();
+
+  std::vector<uint8_t> bytes;
+  auto bytes_written = serialize(s, bytes);
+
+  std::error_code ec;
+  auto before = num_allocations();
+  auto consumed = validate<my_struct>(bytes, ec);
+  auto after = num_allocations();
+
+  REQUIRE((bool)ec == false);
+  REQUIRE(consumed == bytes_written);
+  REQUIRE(after == before); // nothing allocated
+}
+
+TEST_CASE("Validate with version and checksum" * test_suite("validate")) {
+  using namespace test_validate;
+  auto s = make_struct();
+
+  constexpr auto OPTIONS = options::with_version | options::with_checksum;
+
+  std::vector<uint8_t> bytes;
+  auto bytes_written = serialize<OPTIONS>(s, bytes);
+
+  {
+    // first call computes and caches the type hash
+    std::error_code ec;
+    REQUIRE(validate<OPTIONS, my_struct>(bytes, ec) == bytes_written);
+    REQUIRE((bool)ec == false);
+  }
+
+  {
+    std::error_code ec;
+    auto before = num_allocations();
+    auto consumed = validate<OPTIONS, my_struct>(bytes, ec);
+    auto after = num_allocations();
+
+    REQUIRE((bool)ec == false);
+    REQUIRE(consumed == bytes_written);
+    REQUIRE(after == before);
+  }
+
+  {
+    // corrupt a byte
+    bytes[6] ^= 0x01;
+    std::error_code ec;
+    REQUIRE(validate<OPTIONS, my_struct>(bytes, ec) == 0);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::bad_message));
+  }
+}
+
+TEST_CASE("Validate with chunk index" * test_suite("validate")) {
+  struct my_struct {
+    std::vector<std::string> v;
+  };
+
+  my_struct s{};
+  for (int i = 0; i < 10000; ++i) {
+    s.v.push_back(std::to_string(i));
+  }
+
+  constexpr auto OPTIONS = options::with_chunk_index;
+  std::vector<uint8_t> bytes;
+  auto bytes_written = serialize<OPTIONS>(s, bytes);
+
+  std::error_code ec;
+  auto before = num_allocations();
+  auto consumed = validate<OPTIONS, my_struct>(bytes, ec);
+  auto after = num_allocations();
+
+  REQUIRE((bool)ec == false);
+  REQUIRE(consumed == bytes_written);
+
+  // the chunk table is walked in place
+  REQUIRE(after == before);
+}
+
+TEST_CASE("Validate trailing bytes" * test_suite("validate")) {
+  struct my_struct {
+    std::string a;
+  };
+
+  my_struct s{"message"};
+
+  // two messages back to back
+  std::vector<uint8_t> bytes;
+  auto first = serialize(s, bytes);
+  std::vector<uint8_t> second;
+  serialize(s, second);
+  bytes.insert(bytes.end(), second.begin(), second.end());
+
+  std::error_code ec;
+  REQUIRE(validate<my_struct>(bytes, ec) == first);
+  REQUIRE((bool)ec == false);
+}
+
+TEST_CASE("Validate malformed input" * test_suite("validate")) {
+  struct my_struct {
+    std::vector<uint16_t> a;
+    std::unique_ptr<int> b;
+  };
+
+  SUBCASE("size larger than input") {
+    // vector claims 200 elements
+    std::vector<uint8_t> bytes{0xC8, 0x01, 0x00, 0x00};
+    std::error_code ec;
+    REQUIRE(validate<my_struct>(bytes, ec) == 0);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::value_too_large));
+  }
+
+  SUBCASE("bad unique_ptr flag") {
+    std::vector<uint8_t> bytes{0x01, 0x05, 0x00, 0x07, 0x05};
+    std::error_code ec;
+    REQUIRE(validate<my_struct>(bytes, ec) == 0);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::illegal_byte_sequence));
+  }
+
+  SUBCASE("empty input") {
+    std::vector<uint8_t> bytes;
+    std::error_code ec;
+    REQUIRE(validate<my_struct>(bytes, ec) == 0);
+    REQUIRE(ec.value() == static_cast<int>(std::errc::message_size));
+  }
+}